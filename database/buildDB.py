@@ -20,30 +20,176 @@
 #
 # $Id$
 
-import urllib.request, string, sqlite3
+# Build the table of the Unicode character names and write it to database.c
+#
+# Usage: buildDB.py [UnicodeData.txt]
+#
+# If no file is given, UnicodeData.txt is downloaded from www.unicode.org.
+#
+# The names are split in words which are stored once in a lexicon. Each name is
+# then stored as a sequence of word indices (1 byte for the 128 most frequent
+# words, 2 bytes otherwise). The codes are stored as ranges of consecutive codes
+# which are searched by dichotomy. The names are looked up with a minimal
+# perfect hash (hash and displace). The names of CJK and Tangut ideographs are
+# not stored since they are built algorithmically from their codes (as well
+# as the names of the Hangul syllables which are built by unicode.c).
+
+import sys, urllib.request
 
-print("Open URL...")
-unicodata = urllib.request.urlopen("http://www.unicode.org/Public/UNIDATA/UnicodeData.txt")
-print("Read data from URL...")
-lignes = unicodata.readlines()
-print("Close URL...")
-unicodata.close()
+# Must match the hash function of unicode.c
+def nameHash(name, seed):
+    h = (0x811c9dc5 ^ seed) & 0xffffffff
+    for c in name:
+        h ^= c
+        h = (h * 0x01000193) & 0xffffffff
+    return h
 
-print("Open SQLite DB...")
-connection = sqlite3.connect('quesoglc.db')
-db = connection.cursor()
-db.execute('''create table unicode (rank INTEGER PRIMARY KEY, code INTEGER, name TEXT)''')
+def writeArray(out, ctype, name, values, perLine = 12):
+    out.write('const %s %s[%d] = {\n' % (ctype, name, len(values)))
+    for i in range(0, len(values), perLine):
+        out.write('  ' + ', '.join(str(v) for v in values[i:i+perLine]))
+        out.write(',\n' if i + perLine < len(values) else '\n')
+    out.write('};\n\n')
 
-print("Write data into SQLite DB...")
+if len(sys.argv) > 1:
+    print("Read data from " + sys.argv[1] + "...")
+    with open(sys.argv[1], 'rb') as f:
+        lignes = f.readlines()
+else:
+    print("Open URL...")
+    unicodata = urllib.request.urlopen("http://www.unicode.org/Public/UNIDATA/UnicodeData.txt")
+    print("Read data from URL...")
+    lignes = unicodata.readlines()
+    print("Close URL...")
+    unicodata.close()
+
+print("Parse data...")
+names = []
+ideographs = []
 for s in lignes:
     liste = s.split(';'.encode())
-    code = eval('0x'.encode()+liste[0])
+    if len(liste) < 2:
+        continue
+    code = int(liste[0], 16)
     name = liste[1]
-    if name == '<control>':
+    if name == b'<control>':
+        continue
+    if name.startswith(b'<'):
+        # Ranges of characters : only the ideographs have a name
+        if name.endswith(b', First>'):
+            first = code
+        elif name.startswith(b'<CJK Ideograph'):
+            ideographs.append((first, code, 'CJK UNIFIED IDEOGRAPH-'))
+        elif name.startswith(b'<Tangut Ideograph'):
+            ideographs.append((first, code, 'TANGUT IDEOGRAPH-'))
+        continue
+    assert len(name) < 128
+    names.append((code, name))
+
+names.sort()
+count = len(names)
+assert count < 65536
+
+print("Build the lexicon...")
+frequency = {}
+for code, name in names:
+    for word in name.split(b' '):
+        frequency[word] = frequency.get(word, 0) + 1
+words = sorted(frequency, key = lambda w: (-frequency[w], w))
+assert len(words) < 32768
+wordIndex = dict((w, i) for i, w in enumerate(words))
+
+lexicon = []
+wordOffsets = []
+for word in words:
+    wordOffsets.append(len(lexicon))
+    lexicon.extend(word)
+wordOffsets.append(len(lexicon))
+
+phrases = []
+phraseOffsets = []
+for code, name in names:
+    phraseOffsets.append(len(phrases))
+    for word in name.split(b' '):
+        i = wordIndex[word]
+        if i < 128:
+            phrases.append(i)
+        else:
+            phrases.extend([0x80 | (i >> 8), i & 0xff])
+phraseOffsets.append(len(phrases))
+
+print("Build the ranges of codes...")
+ranges = []
+for i, (code, name) in enumerate(names):
+    if ranges and ranges[-1][0] + ranges[-1][2] == code \
+       and ranges[-1][2] < 65535:
+        ranges[-1][2] += 1
+    else:
+        ranges.append([code, i, 1])
+
+print("Build the minimal perfect hash...")
+bucketCount = (count + 2) // 3
+buckets = [[] for i in range(bucketCount)]
+for i, (code, name) in enumerate(names):
+    buckets[nameHash(name, 0) % bucketCount].append(i)
+order = sorted(range(bucketCount), key = lambda b: -len(buckets[b]))
+seeds = [0] * bucketCount
+slots = [-1] * count
+free = []
+for b in order:
+    bucket = buckets[b]
+    if not bucket:
+        continue
+    if len(bucket) == 1:
+        # Single names are directly stored in a free slot
+        if not free:
+            free = [i for i in range(count) if slots[i] < 0]
+        slot = free.pop()
+        slots[slot] = bucket[0]
+        seeds[b] = -slot - 1
         continue
-    db.execute('''insert into unicode (code,name) values (?,?)''',(code,name))
+    seed = 1
+    while True:
+        positions = [nameHash(names[i][1], seed) % count for i in bucket]
+        if len(set(positions)) == len(positions) \
+           and all(slots[p] < 0 for p in positions):
+            break
+        seed += 1
+    for i, p in zip(bucket, positions):
+        slots[p] = i
+    seeds[b] = seed
+assert all(s >= 0 for s in slots)
 
-connection.commit()
-db.close()
+print("Write database.c...")
+with open('database.c', 'w') as out:
+    out.write('/* QuesoGLC\n'
+              ' * A free implementation of the OpenGL Character Renderer (GLC)\n'
+              ' *\n'
+              ' * This file has been generated by database/buildDB.py from\n'
+              ' * UnicodeData.txt : do not edit.\n'
+              ' */\n\n'
+              '#include "internal.h"\n\n')
+    out.write('const GLint __glcNameCount = %d;\n' % count)
+    out.write('const GLint __glcNameRangeCount = %d;\n' % len(ranges))
+    out.write('const GLint __glcNameBucketCount = %d;\n' % bucketCount)
+    out.write('const GLint __glcIdeographRangeCount = %d;\n\n'
+              % len(ideographs))
+    writeArray(out, 'GLCchar8', '__glcNameLexicon', lexicon, 16)
+    writeArray(out, 'GLCchar32', '__glcNameWordOffsets', wordOffsets)
+    writeArray(out, 'GLCchar8', '__glcNamePhrases', phrases, 16)
+    writeArray(out, 'GLCchar32', '__glcNamePhraseOffsets', phraseOffsets)
+    out.write('const __GLCnameRange __glcNameRanges[%d] = {\n' % len(ranges))
+    out.write(',\n'.join('  {0x%x, %d, %d}' % tuple(r) for r in ranges))
+    out.write('\n};\n\n')
+    writeArray(out, 'GLint', '__glcNameSeeds', seeds)
+    writeArray(out, 'GLCchar16', '__glcNameSlots', slots)
+    out.write('const __GLCideographRange __glcIdeographRanges[%d] = {\n'
+              % len(ideographs))
+    out.write(',\n'.join('  {0x%x, 0x%x, "%s"}' % r for r in ideographs))
+    out.write('\n};\n')
 
+print("%d names, %d words, %d ranges, %d bytes" % (count, len(words),
+      len(ranges), len(lexicon) + 4 * len(wordOffsets) + len(phrases)
+      + 4 * len(phraseOffsets) + 8 * len(ranges) + 4 * len(seeds)
+      + 2 * len(slots)))
 print("Success !!!")
@@ -325,6 +325,22 @@ GLCAPI void APIENTRY glcRenderParameterfQSO(GLenum inAttrib, GLfloat inVal);
 #define GLC_QSO_render_pixmap
 #define GLC_PIXMAP_QSO                            0x8011
 
+#define GLC_QSO_atlas_page_budget                 1
+#define GLC_ATLAS_PAGE_BUDGET_QSO                 0x8012
+
+#define GLC_QSO_preload_metrics                   1
+#define GLC_PRELOAD_METRICS_QSO                   0x8013
+
+#define GLC_QSO_async_catalog                     1
+#define GLC_ASYNC_CATALOG_QSO                     0x8014
+#define GLC_PENDING_CATALOG_COUNT_QSO             0x8015
+
+#define GLC_QSO_char_codes                        1
+GLCAPI GLint APIENTRY glcGetMasterCharCodesQSO(GLint inMaster, GLint inIndex,
+					       GLint inCount, GLint* outCodes);
+GLCAPI GLint APIENTRY glcGetFontCharCodesQSO(GLint inFont, GLint inIndex,
+					     GLint inCount, GLint* outCodes);
+
 #if defined (__cplusplus)
 }
 #endif
@@ -0,0 +1,185 @@
+/* QuesoGLC
+ * A free implementation of the OpenGL Character Renderer (GLC)
+ * Copyright (c) 2002, 2004-2009, Bertrand Coconnier
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+/* $Id$ */
+
+/** \file
+ *  defines the routines used to cache the images of the characters rendered
+ *  with GLC_BITMAP and GLC_PIXMAP_QSO.
+ *
+ *  Each glyph keeps the list of its images that have been rasterized with
+ *  different parameters (render style, bitmap matrix, size, resolution and
+ *  hinting). All the images of a context are also stored in a LRU list so that
+ *  the oldest ones can be removed when the cache exceeds GLC_BITMAP_CACHE_SIZE
+ *  bytes.
+ */
+
+#include "internal.h"
+#include "bitmap.h"
+
+
+
+/* Compute the parameters which determine the image of a glyph with the current
+ * state of the context. They are stored in the members of 'outKey'.
+ * The bitmap matrix is quantized the same way than the transform that is given
+ * to FreeType, so images that would be identical share the same key.
+ */
+static void __glcBitmapCacheGetKey(const __GLCcontext* inContext,
+				   const GLfloat inScaleX,
+				   const GLfloat inScaleY,
+				   __GLCbitmapElement* outKey)
+{
+  GLfloat *transform = inContext->bitmapMatrix;
+
+  outKey->renderStyle = inContext->renderState.renderStyle;
+  outKey->matrix[0] = (FT_Fixed)(transform[0] * 65536. / inScaleX);
+  outKey->matrix[1] = (FT_Fixed)(transform[2] * 65536. / inScaleY);
+  outKey->matrix[2] = (FT_Fixed)(transform[1] * 65536. / inScaleX);
+  outKey->matrix[3] = (FT_Fixed)(transform[3] * 65536. / inScaleY);
+  outKey->scale[0] = (FT_F26Dot6)(inScaleX * 64.);
+  outKey->scale[1] = (FT_F26Dot6)(inScaleY * 64.);
+
+  /* See __glcFaceDescPrepareFont() and __glcFaceDescPrepareGlyph() */
+  if (inContext->enableState.glObjects) {
+    outKey->resolution = 72;
+    outKey->hinting = GL_TRUE;
+  }
+  else {
+    outKey->resolution = (GLint)inContext->renderState.resolution;
+    outKey->hinting = inContext->enableState.hinting;
+  }
+}
+
+
+
+/* This function looks for an image of the glyph 'inGlyph' which has been
+ * rasterized with the current state of the context. If it is found, the image
+ * becomes the most recently used one and it is returned. Otherwise the
+ * function returns NULL.
+ */
+__GLCbitmapElement* __glcBitmapCacheLookup(__GLCcontext* inContext,
+					   const __GLCglyph* inGlyph,
+					   const GLfloat inScaleX,
+					   const GLfloat inScaleY)
+{
+  __GLCbitmapElement key;
+  __GLCbitmapElement* image = NULL;
+
+  if (!inGlyph->bitmapObject)
+    return NULL;
+
+  __glcBitmapCacheGetKey(inContext, inScaleX, inScaleY, &key);
+
+  for (image = inGlyph->bitmapObject; image; image = image->next) {
+    if ((image->renderStyle == key.renderStyle)
+	&& !memcmp(image->matrix, key.matrix, 4 * sizeof(FT_Fixed))
+	&& !memcmp(image->scale, key.scale, 2 * sizeof(FT_F26Dot6))
+	&& (image->resolution == key.resolution)
+	&& (image->hinting == key.hinting)) {
+      FT_List_Up(&inContext->bitmapList, (FT_ListNode)image);
+      return image;
+    }
+  }
+
+  return NULL;
+}
+
+
+
+/* This function rasterizes the glyph 'inGlyph' with the current state of the
+ * context and stores the resulting image in the cache. The glyph must have
+ * been loaded in the face of 'inFont'.
+ * If the cache then exceeds GLC_BITMAP_CACHE_SIZE bytes, the least recently
+ * used images are removed from the cache (except the new one).
+ */
+__GLCbitmapElement* __glcBitmapCacheCreate(const __GLCfont* inFont,
+					   __GLCcontext* inContext,
+					   __GLCglyph* inGlyph,
+					   const GLfloat inScaleX,
+					   const GLfloat inScaleY)
+{
+  __GLCbitmapElement* image = NULL;
+  GLint width = 0, height = 0;
+  GLint boundingBox[4] = {0, 0, 0, 0};
+  GLint size = 0;
+
+  if (!__glcFontGetBitmapSize(inFont, &width, &height, inScaleX, inScaleY, 0,
+			      boundingBox, inContext))
+    return NULL;
+
+  /* GLC_BITMAP images use 1 bit per pixel and their width is a multiple of 8
+   * pixels. GLC_PIXMAP_QSO images use 1 byte per pixel.
+   */
+  if (inContext->renderState.renderStyle == GLC_BITMAP)
+    size = (width >> 3) * height;
+  else
+    size = width * height;
+
+  /* The image is stored right after the element */
+  image = (__GLCbitmapElement*)__glcMalloc(sizeof(__GLCbitmapElement) + size);
+  if (!image) {
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    return NULL;
+  }
+
+  __glcBitmapCacheGetKey(inContext, inScaleX, inScaleY, image);
+  image->node.data = image;
+  image->glyph = inGlyph;
+  image->width = width;
+  image->height = height;
+  memcpy(image->boundingBox, boundingBox, 4 * sizeof(GLint));
+  image->size = size;
+  image->buffer = (GLubyte*)(image + 1);
+
+  /* render the glyph */
+  if (!__glcFontGetBitmap(inFont, width, height, image->buffer, inContext)) {
+    __glcFree(image);
+    return NULL;
+  }
+
+  image->next = inGlyph->bitmapObject;
+  inGlyph->bitmapObject = image;
+  FT_List_Insert(&inContext->bitmapList, (FT_ListNode)image);
+  inContext->bitmapCacheSize += size;
+
+  while ((inContext->bitmapCacheSize > GLC_BITMAP_CACHE_SIZE)
+	 && (inContext->bitmapList.tail != (FT_ListNode)image))
+    __glcReleaseBitmapElement((__GLCbitmapElement*)inContext->bitmapList.tail,
+			      inContext);
+
+  return image;
+}
+
+
+
+/* This function removes an image from the cache and from the list of images of
+ * its glyph.
+ */
+void __glcReleaseBitmapElement(__GLCbitmapElement* This,
+			       __GLCcontext* inContext)
+{
+  __GLCbitmapElement** link = &This->glyph->bitmapObject;
+
+  while (*link != This)
+    link = &(*link)->next;
+  *link = This->next;
+
+  inContext->bitmapCacheSize -= This->size;
+  FT_List_Remove(&inContext->bitmapList, (FT_ListNode)This);
+  __glcFree(This);
+}
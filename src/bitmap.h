@@ -0,0 +1,67 @@
+/* QuesoGLC
+ * A free implementation of the OpenGL Character Renderer (GLC)
+ * Copyright (c) 2002, 2004-2009, Bertrand Coconnier
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+/* $Id$ */
+
+/** \file
+ *  header of the routines used to cache the images of the characters rendered
+ *  with GLC_BITMAP and GLC_PIXMAP_QSO.
+ */
+
+#ifndef __glc_bitmap_h
+#define __glc_bitmap_h
+
+#include "ofont.h"
+
+/* Maximum number of bytes used by the images that are stored in the cache.
+ * The least recently used images are removed from the cache when it is
+ * exceeded.
+ */
+#define GLC_BITMAP_CACHE_SIZE   (1 << 20)
+
+struct __GLCbitmapElementRec {
+  FT_ListNodeRec node;		/* Node of the LRU list of the context */
+  __GLCbitmapElement* next;	/* Next image of the same glyph */
+  __GLCglyph* glyph;
+
+  /* Parameters that the image has been rasterized with */
+  GLint renderStyle;
+  FT_Fixed matrix[4];		/* GLC_BITMAP_MATRIX divided by the scale */
+  FT_F26Dot6 scale[2];		/* Size of the character */
+  GLint resolution;
+  GLboolean hinting;
+
+  GLint width;
+  GLint height;
+  GLint boundingBox[4];		/* Bounding box in 26.6 pixel coordinates */
+  GLint size;			/* Size of the image in bytes */
+  GLubyte* buffer;
+};
+
+__GLCbitmapElement* __glcBitmapCacheLookup(__GLCcontext* inContext,
+					   const __GLCglyph* inGlyph,
+					   const GLfloat inScaleX,
+					   const GLfloat inScaleY);
+__GLCbitmapElement* __glcBitmapCacheCreate(const __GLCfont* inFont,
+					   __GLCcontext* inContext,
+					   __GLCglyph* inGlyph,
+					   const GLfloat inScaleX,
+					   const GLfloat inScaleY);
+void __glcReleaseBitmapElement(__GLCbitmapElement* This,
+			       __GLCcontext* inContext);
+#endif
@@ -47,6 +47,7 @@
 #include <string.h>
 
 #include "internal.h"
+#include "texture.h"
 
 
 
@@ -178,6 +179,12 @@ void APIENTRY glcDeleteGLObjects(void)
     ctx->texture.height = 0;
   }
 
+  /* Delete the texture cache of the immediate mode */
+  if (ctx->textureCache) {
+    glDeleteTextures(1, &ctx->textureCache->id);
+    __glcTextureCacheDestroy(ctx);
+  }
+
   /* Delete the pixel buffer object used for immediate mode */
   if (GLEW_ARB_pixel_buffer_object && ctx->texture.bufferObjectID) {
     glDeleteBuffersARB(1, &ctx->texture.bufferObjectID);
@@ -188,6 +195,7 @@ void APIENTRY glcDeleteGLObjects(void)
   if (GLEW_ARB_vertex_buffer_object && ctx->atlas.bufferObjectID) {
     glDeleteBuffersARB(1, &ctx->atlas.bufferObjectID);
     ctx->atlas.bufferObjectID = 0;
+    ctx->atlasBufferSize = 0;
   }
 }
 
@@ -211,6 +219,8 @@ static void __glcChangeState(const GLCenum inAttrib, const GLboolean value)
   case GLC_HINTING_QSO: /* QuesoGLC Extension */
   case GLC_EXTRUDE_QSO: /* QuesoGLC Extension */
   case GLC_KERNING_QSO: /* QuesoGLC Extension */
+  case GLC_PRELOAD_METRICS_QSO: /* QuesoGLC Extension */
+  case GLC_ASYNC_CATALOG_QSO: /* QuesoGLC Extension */
     break;
   default:
     __glcRaiseError(GLC_PARAMETER_ERROR);
@@ -234,17 +244,21 @@ static void __glcChangeState(const GLCenum inAttrib, const GLboolean value)
     break;
   case GLC_MIPMAP:
     ctx->enableState.mipmap = value;
-    /* Update the mipmap setting of the texture atlas */
-    if (ctx->atlas.id) {
+    /* Update the mipmap setting of the pages of the texture atlas */
+    if (GLC_ARRAY_LENGTH(ctx->atlasPages)) {
       GLuint boundTexture = 0;
+      int i = 0;
+
       glGetIntegerv(GL_TEXTURE_BINDING_2D, (GLint*)&boundTexture);
-      glBindTexture(GL_TEXTURE_2D, ctx->atlas.id);
-      if (ctx->enableState.mipmap)
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
-			GL_LINEAR_MIPMAP_LINEAR);
-      else
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
-			GL_LINEAR);
+      for (i = 0; i < GLC_ARRAY_LENGTH(ctx->atlasPages); i++) {
+	glBindTexture(GL_TEXTURE_2D, GLC_ATLAS_PAGE(ctx, i)->id);
+	if (ctx->enableState.mipmap)
+	  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+			  GL_LINEAR_MIPMAP_LINEAR);
+	else
+	  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+			  GL_LINEAR);
+      }
       glBindTexture(GL_TEXTURE_2D, boundTexture);
     }
     break;
@@ -257,6 +271,12 @@ static void __glcChangeState(const GLCenum inAttrib, const GLboolean value)
   case GLC_KERNING_QSO:
     ctx->enableState.kerning = value;
     break;
+  case GLC_PRELOAD_METRICS_QSO:
+    ctx->enableState.preloadMetrics = value;
+    break;
+  case GLC_ASYNC_CATALOG_QSO:
+    ctx->enableState.asyncCatalog = value;
+    break;
   }
 }
 
@@ -295,6 +315,16 @@ static void __glcChangeState(const GLCenum inAttrib, const GLboolean value)
  *      <td>0x8007</td>
  *      <td><b>GL_FALSE</b></td>
  *    </tr>
+ *    <tr>
+ *      <td><b>GLC_PRELOAD_METRICS_QSO</b></td>
+ *      <td>0x8013</td>
+ *      <td><b>GL_FALSE</b></td>
+ *    </tr>
+ *    <tr>
+ *      <td><b>GLC_ASYNC_CATALOG_QSO</b></td>
+ *      <td>0x8014</td>
+ *      <td><b>GL_FALSE</b></td>
+ *    </tr>
  *  </table>
  *  </center>
  *  \param inAttrib A symbolic constant indicating a GLC capability.
@@ -332,6 +362,27 @@ void APIENTRY glcDisable(GLCenum inAttrib)
  *    before the rendering commands in order to obtain the desired thickness.
  *  - \b GLC_KERNING_QSO: if enabled, GLC uses kerning information when
  *    rendering or measuring a string. Not all fonts have kerning information.
+ *  - \b GLC_PRELOAD_METRICS_QSO: if enabled and \b GLC_GL_OBJECTS is enabled,
+ *    the advances and the bounding boxes of the glyphs are read from the font
+ *    file by blocks of consecutive glyphs rather than one glyph at a time. It
+ *    speeds up the measurement of long strings. The metrics are then computed
+ *    without hinting, hence they may slightly differ from the metrics that are
+ *    returned when this attribute is disabled. The glyphs which metrics have
+ *    already been cached are not affected.
+ *  - \b GLC_ASYNC_CATALOG_QSO: if enabled, glcAppendCatalog() and
+ *    glcPrependCatalog() return immediately and the fonts of the catalog are
+ *    scanned by a background thread. The catalog is added to
+ *    \b GLC_CATALOG_LIST and its masters are appended to the master list by
+ *    the next command that uses the catalogs or the masters once the scan is
+ *    over. The IDs of the masters that were already defined do not change.
+ *    glcGeti() with argument \b GLC_PENDING_CATALOG_COUNT_QSO returns the
+ *    number of catalogs which are not loaded yet. A catalog that can not be
+ *    loaded is not added to \b GLC_CATALOG_LIST and the failure is reported
+ *    by the next call to glcGeti() with argument
+ *    \b GLC_PENDING_CATALOG_COUNT_QSO, which raises \b GLC_RESOURCE_ERROR.
+ *    The fonts are scanned in the background only if QuesoGLC has been built
+ *    with a thread-safe Fontconfig (version 2.10.91 or later), otherwise they
+ *    are scanned before glcAppendCatalog() or glcPrependCatalog() returns.
  *
  *  \param inAttrib A symbolic constant indicating a GLC attribute.
  *  \sa glcDisable()
@@ -443,6 +494,7 @@ const GLCchar* APIENTRY glcGetListc(GLCenum inAttrib, GLint inIndex)
     return GLC_NONE;
   }
 
+  __glcContextPublishCatalogs(ctx);
   catalog = __glcContextGetCatalogPath(ctx, inIndex);
   if (!catalog)
     return GLC_NONE;
@@ -619,31 +671,29 @@ GLint APIENTRY glcGetListi(GLCenum inAttrib, GLint inIndex)
     }
     break;
   case GLC_TEXTURE_OBJECT_LIST:
-    switch(inIndex) {
-      /* QuesoGLC uses at most 2 textures: one for immediate mode rendering and
-       * another one for the texture atlas. That's all. They are virtually
-       * stored in the following order: texture for immediate mode first, then
-       * texture atlas.
-       */
-      case 0:
-	if (ctx->texture.id)
-	  return ctx->texture.id;
-	/* If the texture for immediate mode does not exist, then the first
-	 * texture is the texture atlas.
-	 * FIXME: if the texture atlas is created first and the texture for
-	 * immediate mode is created after then this algorithm leads to a
-	 * modification of the order which is not satisfying...
-	 */
-	if (ctx->atlas.id)
-	  return ctx->atlas.id;
-	break;
-      case 1:
-	if ((ctx->texture.id) && (ctx->atlas.id))
-	  return ctx->atlas.id;
-	break;
-      default:
-	break;
+    /* QuesoGLC uses one texture for immediate mode rendering, one texture for
+     * the texture cache of the immediate mode and one texture for each page of
+     * the texture atlas. They are virtually stored in the following order:
+     * texture for immediate mode first, then the texture cache and the pages
+     * of the texture atlas.
+     * FIXME: if the texture atlas is created first and the texture for
+     * immediate mode is created after then this algorithm leads to a
+     * modification of the order which is not satisfying...
+     */
+    if (ctx->texture.id) {
+      if (!inIndex)
+	return ctx->texture.id;
+      inIndex--;
+    }
+
+    if (ctx->textureCache) {
+      if (!inIndex)
+	return ctx->textureCache->id;
+      inIndex--;
     }
+
+    if (inIndex < GLC_ARRAY_LENGTH(ctx->atlasPages))
+      return GLC_ATLAS_PAGE(ctx, inIndex)->id;
     break;
   case GLC_BUFFER_OBJECT_LIST_QSO: /* QuesoGLC extension */
     switch(inIndex) {
@@ -788,10 +838,13 @@ GLvoid* APIENTRY glcGetPointer(GLCenum inAttrib)
  */
 const GLCchar* APIENTRY glcGetc(GLCenum inAttrib)
 {
-  static const char* __glcExtensions1 = "GLC_QSO_attrib_stack";
+  static const char* __glcExtensions1 = "GLC_QSO_async_catalog"
+    " GLC_QSO_atlas_page_budget GLC_QSO_attrib_stack";
   static const char* __glcExtensions2 = " GLC_QSO_buffer_object";
-  static const char* __glcExtensions3 = " GLC_QSO_extrude GLC_QSO_hinting"
-    " GLC_QSO_kerning GLC_QSO_matrix_stack GLC_QSO_render_parameter"
+  static const char* __glcExtensions3 = " GLC_QSO_char_codes"
+    " GLC_QSO_extrude GLC_QSO_hinting"
+    " GLC_QSO_kerning GLC_QSO_matrix_stack GLC_QSO_preload_metrics"
+    " GLC_QSO_render_parameter"
     " GLC_QSO_render_pixmap GLC_QSO_utf8 GLC_SGI_full_name";
   static const GLCchar8* __glcVendor = (const GLCchar8*) "The QuesoGLC Project";
 #ifdef HAVE_CONFIG_H
@@ -826,14 +879,14 @@ const GLCchar* APIENTRY glcGetc(GLCenum inAttrib)
   switch(inAttrib) {
   case GLC_EXTENSIONS:
     {
-      GLCchar8 __glcExtensions[256];
+      GLCchar8 __glcExtensions[512];
 
       /* This assertion checks that the fixed sized array __glcExtensions is
        * large enough to store the extensions name. If this is not the case
        * then the size must be updated.
        */
       assert((strlen(__glcExtensions1) + strlen(__glcExtensions2)
-	      + strlen(__glcExtensions3)) <= 256);
+	      + strlen(__glcExtensions3)) < 512);
 
       /* Build the extensions string depending on the available GL extensions */
       strcpy((char*)__glcExtensions, __glcExtensions1);
@@ -1038,6 +1091,12 @@ GLfloat* APIENTRY glcGetfv(GLCenum inAttrib, GLfloat* outVec)
  *  <tr>
  *    <td><b>GLC_BUFFER_OBJECT_COUNT_QSO</b></td> <td>0x800E</td> <td>0</td>
  *  </tr>
+ *  <tr>
+ *    <td><b>GLC_ATLAS_PAGE_BUDGET_QSO</b></td> <td>0x8012</td> <td>4</td>
+ *  </tr>
+ *  <tr>
+ *    <td><b>GLC_PENDING_CATALOG_COUNT_QSO</b></td> <td>0x8015</td> <td>0</td>
+ *  </tr>
  *  </table>
  *  </center>
  *  \param inAttrib Attribute for which an integer variable is requested.
@@ -1073,6 +1132,8 @@ GLint APIENTRY glcGeti(GLCenum inAttrib)
   case GLC_MAX_MATRIX_STACK_DEPTH_QSO: /* QuesoGLC extension */
   case GLC_ATTRIB_STACK_DEPTH_QSO:     /* QuesoGLC extension */
   case GLC_MAX_ATTRIB_STACK_DEPTH_QSO: /* QuesoGLC extension */
+  case GLC_ATLAS_PAGE_BUDGET_QSO:      /* QuesoGLC extension */
+  case GLC_PENDING_CATALOG_COUNT_QSO:  /* QuesoGLC extension */
     break;
   case GLC_BUFFER_OBJECT_COUNT_QSO:    /* QuesoGLC extension */
     /* This parameter is available only if the corresponding GL extensions are
@@ -1096,6 +1157,9 @@ GLint APIENTRY glcGeti(GLCenum inAttrib)
     return 0;
   }
 
+  /* Publish the catalogs that have been loaded in the background */
+  __glcContextPublishCatalogs(ctx);
+
   /* Returns the requested value */
   switch(inAttrib) {
   case GLC_CATALOG_COUNT:
@@ -1135,7 +1199,8 @@ GLint APIENTRY glcGeti(GLCenum inAttrib)
     return ctx->stringState.stringType;
   case GLC_TEXTURE_OBJECT_COUNT:
     count += (ctx->texture.id ? 1 : 0);
-    count += (ctx->atlas.id ? 1 : 0);
+    count += (ctx->textureCache ? 1 : 0);
+    count += GLC_ARRAY_LENGTH(ctx->atlasPages);
     return count;
   case GLC_VERSION_MAJOR:
     return __glcCommonArea.versionMajor;
@@ -1149,6 +1214,10 @@ GLint APIENTRY glcGeti(GLCenum inAttrib)
     return ctx->attribStackDepth;
   case GLC_MAX_ATTRIB_STACK_DEPTH_QSO: /* QuesoGLC extension */
     return GLC_MAX_ATTRIB_STACK_DEPTH;
+  case GLC_ATLAS_PAGE_BUDGET_QSO:      /* QuesoGLC extension */
+    return ctx->renderState.atlasPageBudget;
+  case GLC_PENDING_CATALOG_COUNT_QSO:  /* QuesoGLC extension */
+    return __glcContextGetPendingCatalogCount(ctx);
   case GLC_BUFFER_OBJECT_COUNT_QSO:    /* QuesoGLC extension */
     count += (ctx->texture.bufferObjectID ? 1 : 0);
     count += (ctx->atlas.bufferObjectID ? 1 : 0);
@@ -1197,6 +1266,8 @@ GLboolean APIENTRY glcIsEnabled(GLCenum inAttrib)
   case GLC_HINTING_QSO: /* QuesoGLC Extension */
   case GLC_EXTRUDE_QSO: /* QuesoGLC Extension */
   case GLC_KERNING_QSO: /* QuesoGLC Extension */
+  case GLC_PRELOAD_METRICS_QSO: /* QuesoGLC Extension */
+  case GLC_ASYNC_CATALOG_QSO: /* QuesoGLC Extension */
     break;
   default:
     __glcRaiseError(GLC_PARAMETER_ERROR);
@@ -1224,6 +1295,10 @@ GLboolean APIENTRY glcIsEnabled(GLCenum inAttrib)
     return ctx->enableState.extrude;
   case GLC_KERNING_QSO: /* QuesoGLC Extension */
     return ctx->enableState.kerning;
+  case GLC_PRELOAD_METRICS_QSO: /* QuesoGLC Extension */
+    return ctx->enableState.preloadMetrics;
+  case GLC_ASYNC_CATALOG_QSO: /* QuesoGLC Extension */
+    return ctx->enableState.asyncCatalog;
   }
 
   return GL_FALSE;
@@ -1388,6 +1463,18 @@ void APIENTRY glcStringType(GLCenum inStringType)
  *    <td>enable</td>
  *  </tr>
  *  <tr>
+ *    <td><b>GLC_PRELOAD_METRICS_QSO</b></td>
+ *    <td>GLboolean</td>
+ *    <td>glcIsEnabled()</td>
+ *    <td>enable</td>
+ *  </tr>
+ *  <tr>
+ *    <td><b>GLC_ASYNC_CATALOG_QSO</b></td>
+ *    <td>GLboolean</td>
+ *    <td>glcIsEnabled()</td>
+ *    <td>enable</td>
+ *  </tr>
+ *  <tr>
  *    <td><b>GLC_RENDER_STYLE</b></td>
  *    <td>GLint</td>
  *    <td>glcGeti()</td>
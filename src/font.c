@@ -339,6 +339,8 @@ void APIENTRY glcFont(GLint inFont)
     }
   }
 
+  __glcContextInvalidateFontCache(ctx);
+
 #ifdef GLC_FT_CACHE
   /* Empties GLC_CURRENT_FONT_LIST */
   FT_List_Finalize(&ctx->currentFontList, NULL,
@@ -475,7 +477,8 @@ GLboolean APIENTRY glcFontFace(GLint inFont, const GLCchar* inFace)
  *
  *  The command raises \b GLC_PARAMETER_ERROR if \e inCharName is not
  *  \b GLC_NONE or an element of the font string's list attribute
- *  \b GLC_CHAR_LIST.
+ *  \b GLC_CHAR_LIST, or if \e inCharName is not \b GLC_NONE and \e inCode is
+ *  greater than 0x10FFFF (the last Unicode code point).
  *  \param inFont The ID of the font
  *  \param inCode The integer ID of a character
  *  \param inCharName The string name of a character
@@ -501,6 +504,9 @@ void APIENTRY glcFontMap(GLint inFont, GLint inCode, const GLCchar* inCharName)
   if (code < 0)
     return;
 
+  /* The fonts that map 'code' may change */
+  __glcContextInvalidateFontCache(ctx);
+
   if (!inCharName)
     /* Remove the character from the map */
     __glcCharMapRemoveChar(font->charMap, code);
@@ -743,6 +749,51 @@ const GLCchar* APIENTRY glcGetFontListc(GLint inFont, GLCenum inAttrib,
 
 
 
+/** \ingroup font
+ *  This command stores in \e outCodes the character codes of the elements
+ *  of the string list \b GLC_CHAR_LIST of the font identified by \e inFont,
+ *  from offset \e inIndex to offset \e inIndex + \e inCount - 1. It is
+ *  equivalent to \e inCount calls to glcGetFontListc() but it returns the
+ *  codes of the characters rather than their names and it is much faster
+ *  when the whole character list is enumerated.
+ *
+ *  The command returns the number of codes that have been stored in
+ *  \e outCodes which is lower than \e inCount if the end of the list has
+ *  been reached.
+ *
+ *  The command raises \b GLC_PARAMETER_ERROR if \e inIndex is less than
+ *  zero or is greater than or equal to the value of the font's
+ *  \b GLC_CHAR_COUNT, or if \e inCount is less than zero.
+ *  \param inFont The font ID
+ *  \param inIndex The offset of the first character in \b GLC_CHAR_LIST
+ *  \param inCount The number of character codes to be stored
+ *  \param outCodes The array where the character codes are stored
+ *  \return The number of character codes stored in \e outCodes
+ *  \sa glcGetFontListc()
+ *  \sa glcGetMasterCharCodesQSO()
+ */
+GLint APIENTRY glcGetFontCharCodesQSO(GLint inFont, GLint inIndex,
+				      GLint inCount, GLint* outCodes)
+{
+  __GLCfont* font = NULL;
+
+  GLC_INIT_THREAD();
+
+  if ((inIndex < 0) || (inCount < 0) || (!outCodes && inCount)) {
+    __glcRaiseError(GLC_PARAMETER_ERROR);
+    return 0;
+  }
+
+  /* Check if the font parameters are valid */
+  font = __glcVerifyFontParameters(inFont);
+  if (!font)
+    return 0;
+
+  return __glcCharMapGetCodes(font->charMap, inIndex, inCount, outCodes);
+}
+
+
+
 /** \ingroup font
  *  This command returns the string name of the character that the font
  *  identified by \e inFont maps \e inCode to.
@@ -1106,6 +1157,8 @@ GLint APIENTRY glcNewFontFromFamily(GLint inFont, const GLCchar* inFamily)
   if (!UinFamily)
     return 0;
 
+  /* Publish the catalogs that have been loaded in the background */
+  __glcContextPublishCatalogs(ctx);
   master = __glcMasterFromFamily(ctx, UinFamily);
 
   __glcFree(UinFamily);
@@ -167,8 +167,6 @@ void _fini(void)
     node = next;
   }
 
-  sqlite3_close(__glcCommonArea.db);
-
   __glcUnlock();
 #ifdef __WIN32__
   DeleteCriticalSection(&__glcCommonArea.section);
@@ -220,7 +218,6 @@ __attribute__((constructor)) void init(void)
 void _init(void)
 #endif
 {
-  int result = 0;
 #if !defined(__WIN32__) && !defined(HAVE_TLS)
   /* A temporary variable is used to store the PTHREAD_ONCE_INIT value because
    * some platforms (namely Mac OSX) define PTHREAD_ONCE_INIT as a structure
@@ -260,6 +257,10 @@ void _init(void)
   /* Initialize the list of context states */
   __glcCommonArea.contextList.head = NULL;
   __glcCommonArea.contextList.tail = NULL;
+  __glcCommonArea.sharedConfig = NULL;
+  __glcCommonArea.sharedConfigRefCount = 0;
+  __glcCommonArea.fontFileList.head = NULL;
+  __glcCommonArea.fontFileList.tail = NULL;
 
   /* Initialize the mutex for access to the contextList array */
 #ifdef __WIN32__
@@ -269,18 +270,6 @@ void _init(void)
     goto FatalError;
 #endif
 
-#if SQLITE_VERSION_NUMBER < 3006000
-  result = sqlite3_open_v2(DATAPATH"/quesoglc.db", &__glcCommonArea.db,
-			   SQLITE_OPEN_READONLY, NULL);
-#else
-  result = sqlite3_open_v2(DATAPATH"/quesoglc.db", &__glcCommonArea.db,
-			   SQLITE_OPEN_NOMUTEX | SQLITE_OPEN_READONLY, NULL);
-#endif
-  if (result) {
-    sqlite3_close(__glcCommonArea.db);
-    goto FatalError;
-  }
-
   return;
 
  FatalError:
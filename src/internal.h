@@ -214,6 +214,36 @@ static inline void* __glcRealloc(void *ptr, size_t size)
 }
 #endif
 
+/* Table of the Unicode character names generated from UnicodeData.txt by
+ * database/buildDB.py and stored in database.c. The names are made of words
+ * stored once in __glcNameLexicon; each name is a sequence of word indices in
+ * __glcNamePhrases.
+ */
+typedef struct __GLCnameRangeRec {
+  GLCchar32 code;		/* First code of the range */
+  GLCchar16 name;		/* Index of the name of 'code' */
+  GLCchar16 count;		/* Number of consecutive codes in the range */
+} __GLCnameRange;
+
+typedef struct __GLCideographRangeRec {
+  GLCchar32 first;
+  GLCchar32 last;
+  const char* prefix;		/* The name is the prefix followed by the code */
+} __GLCideographRange;
+
+extern const GLint __glcNameCount;
+extern const GLint __glcNameRangeCount;
+extern const GLint __glcNameBucketCount;
+extern const GLint __glcIdeographRangeCount;
+extern const GLCchar8 __glcNameLexicon[];
+extern const GLCchar32 __glcNameWordOffsets[];
+extern const GLCchar8 __glcNamePhrases[];
+extern const GLCchar32 __glcNamePhraseOffsets[];
+extern const __GLCnameRange __glcNameRanges[];
+extern const GLint __glcNameSeeds[];
+extern const GLCchar16 __glcNameSlots[];
+extern const __GLCideographRange __glcIdeographRanges[];
+
 /* Find a Unicode name from its code */
 extern const GLCchar8* __glcGetNameFromCode(const GLint code);
 
@@ -69,7 +69,7 @@
  */
 __GLCmaster* __glcVerifyMasterParameters(const GLint inMaster)
 {
-  const __GLCcontext *ctx = GLC_GET_CURRENT_CONTEXT();
+  __GLCcontext *ctx = GLC_GET_CURRENT_CONTEXT();
 
   /* Check if the current thread owns a context state */
   if (!ctx) {
@@ -77,6 +77,9 @@ __GLCmaster* __glcVerifyMasterParameters(const GLint inMaster)
     return NULL;
   }
 
+  /* Publish the catalogs that have been loaded in the background */
+  __glcContextPublishCatalogs(ctx);
+
   /* Verify if the master identifier is in legal bounds */
   if (inMaster >= GLC_ARRAY_LENGTH(ctx->masterHashTable)) {
     __glcRaiseError(GLC_PARAMETER_ERROR);
@@ -205,6 +208,78 @@ const GLCchar* APIENTRY glcGetMasterListc(GLint inMaster, GLCenum inAttrib,
 
 
 
+/** \ingroup master
+ *  This command stores in \e outCodes the character codes of the elements
+ *  of the string list \b GLC_CHAR_LIST of the master identified by
+ *  \e inMaster, from offset \e inIndex to offset \e inIndex + \e inCount - 1.
+ *  It is equivalent to \e inCount calls to glcGetMasterListc() but it returns
+ *  the codes of the characters rather than their names and it is much faster
+ *  when the whole character list is enumerated.
+ *
+ *  The command returns the number of codes that have been stored in
+ *  \e outCodes which is lower than \e inCount if the end of the list has
+ *  been reached.
+ *
+ *  The command raises \b GLC_PARAMETER_ERROR if \e inIndex is less than
+ *  zero or is greater than or equal to the value of the master's
+ *  \b GLC_CHAR_COUNT, or if \e inCount is less than zero.
+ *  \param inMaster The master ID
+ *  \param inIndex The offset of the first character in \b GLC_CHAR_LIST
+ *  \param inCount The number of character codes to be stored
+ *  \param outCodes The array where the character codes are stored
+ *  \return The number of character codes stored in \e outCodes
+ *  \sa glcGetMasterListc()
+ *  \sa glcGetFontCharCodesQSO()
+ */
+GLint APIENTRY glcGetMasterCharCodesQSO(GLint inMaster, GLint inIndex,
+					GLint inCount, GLint* outCodes)
+{
+  __GLCcontext* ctx = NULL;
+  __GLCmaster* master = NULL;
+  GLint count = 0;
+
+  GLC_INIT_THREAD();
+
+  if ((inIndex < 0) || (inCount < 0) || (!outCodes && inCount)) {
+    __glcRaiseError(GLC_PARAMETER_ERROR);
+    return 0;
+  }
+
+  /* Verify that the thread has a current context and that the master
+   * identified by 'inMaster' exists.
+   */
+  master = __glcVerifyMasterParameters(inMaster);
+  if (!master)
+    return 0;
+
+  /* The charmap of a master is the union of the charmaps of its faces, so
+   * building it costs a charset union per face. Since the character list is
+   * usually enumerated by chunks, the charmap of the last enumerated master is
+   * kept by the context until the masters change.
+   */
+  ctx = GLC_GET_CURRENT_CONTEXT();
+  if ((!ctx->masterCharMap) || (ctx->masterCharMapID != inMaster)) {
+    __GLCcharMap* charMap = __glcCharMapCreate(master, ctx);
+
+    if (!charMap) {
+      __glcMasterDestroy(master);
+      return 0;
+    }
+
+    if (ctx->masterCharMap)
+      __glcCharMapDestroy(ctx->masterCharMap);
+    ctx->masterCharMap = charMap;
+    ctx->masterCharMapID = inMaster;
+  }
+
+  count = __glcCharMapGetCodes(ctx->masterCharMap, inIndex, inCount, outCodes);
+
+  __glcMasterDestroy(master);
+  return count;
+}
+
+
+
 /** \ingroup master
  *  This command returns the string name of the character that the master
  *  identified by \e inMaster maps \e inCode to.
@@ -579,6 +579,13 @@ static GLint __glcMeasureCountedString(__GLCcontext *inContext,
   __GLCcharacter prevCode = { 0, NULL, NULL, {0.f, 0.f}};
   GLint shift = 1;
 
+  if (inMeasureChars) {
+    GLC_ARRAY_LENGTH(inContext->measurementBuffer) = 0;
+    /* Make room at once for the metrics of all the characters */
+    if (!__glcArrayReserve(inContext->measurementBuffer, inCount))
+      return 0;
+  }
+
   if ((inContext->renderState.renderStyle == GLC_BITMAP)
       || (inContext->renderState.renderStyle == GLC_PIXMAP_QSO)) {
      /* In order to prevent __glcProcessCharMetric() to transform its results
@@ -590,9 +597,6 @@ static GLint __glcMeasureCountedString(__GLCcontext *inContext,
 
   memset(outVec, 0, 12*sizeof(GLfloat));
 
-  if (inMeasureChars)
-    GLC_ARRAY_LENGTH(inContext->measurementBuffer) = 0;
-
   /* For each character of the string, the measurement are performed and
    * gathered in the context state
    */
@@ -78,28 +78,75 @@ void __glcArrayDestroy(__GLCarray* This)
 
 
 
-/* Allocate a new block of elements in the array 'This'. The function returns
- * NULL if it fails and raises an error accordingly. However the original
- * array is not lost and is kept untouched.
+/* Make room for at least 'inCount' elements in the array 'This'. The room is
+ * doubled each time it is exhausted so that the number of reallocations is
+ * logarithmic in the number of elements that are appended one at a time.
+ * The function returns NULL if it fails and raises an error accordingly.
+ * However the original array is not lost and is kept untouched.
  */
-static __GLCarray* __glcArrayUpdateSize(__GLCarray* This)
+static __GLCarray* __glcArrayUpdateSize(__GLCarray* This, const int inCount)
+{
+  int allocated = This->allocated * 2;
+
+  if (allocated < inCount)
+    allocated = inCount;
+
+  return __glcArrayReserve(This, allocated);
+}
+
+
+
+/* Allocate room for exactly 'inCount' elements in the array 'This' unless it
+ * is already large enough. It is used to make room at once for a number of
+ * elements known in advance. The function returns NULL if it fails and raises
+ * an error accordingly. However the original array is not lost and is kept
+ * untouched.
+ */
+__GLCarray* __glcArrayReserve(__GLCarray* This, const int inCount)
 {
   char* data = NULL;
 
-  data = (char*)__glcRealloc(This->data,
-	(This->allocated + GLC_ARRAY_BLOCK_SIZE) * This->elementSize);
+  if (inCount <= This->allocated)
+    return This;
+
+  data = (char*)__glcRealloc(This->data, inCount * This->elementSize);
   if (!data) {
     __glcRaiseError(GLC_RESOURCE_ERROR);
     return NULL;
   }
   This->data = data;
-  This->allocated += GLC_ARRAY_BLOCK_SIZE;
+  This->allocated = inCount;
 
   return This;
 }
 
 
 
+/* Release the room of the array 'This' that is not used by its elements. The
+ * room of GLC_ARRAY_BLOCK_SIZE elements that the array has been created with
+ * is kept anyway.
+ */
+void __glcArrayShrink(__GLCarray* This)
+{
+  char* data = NULL;
+  int allocated = This->length;
+
+  if (allocated < GLC_ARRAY_BLOCK_SIZE)
+    allocated = GLC_ARRAY_BLOCK_SIZE;
+
+  if (allocated >= This->allocated)
+    return;
+
+  /* If realloc() fails, the array is kept as is : it is not an error */
+  data = (char*)__glcRealloc(This->data, allocated * This->elementSize);
+  if (data) {
+    This->data = data;
+    This->allocated = allocated;
+  }
+}
+
+
+
 /* Append a value to the array. The function may allocate some more room if
  * necessary
  */
@@ -107,7 +154,7 @@ __GLCarray* __glcArrayAppend(__GLCarray* This, const void* inValue)
 {
   /* Update the room if needed */
   if (This->length == This->allocated) {
-    if (!__glcArrayUpdateSize(This))
+    if (!__glcArrayUpdateSize(This, This->length + 1))
       return NULL;
   }
 
@@ -129,7 +176,7 @@ __GLCarray* __glcArrayInsert(__GLCarray* This, const int inRank,
 {
   /* Update the room if needed */
   if (This->length == This->allocated) {
-    if (!__glcArrayUpdateSize(This))
+    if (!__glcArrayUpdateSize(This, This->length + 1))
       return NULL;
   }
 
@@ -174,10 +221,8 @@ void* __glcArrayInsertCell(__GLCarray* This, const int inRank,
 {
   char* newCell = NULL;
 
-  assert(inCells < GLC_ARRAY_BLOCK_SIZE);
-
   if ((This->length + inCells) > This->allocated) {
-    if (!__glcArrayUpdateSize(This))
+    if (!__glcArrayUpdateSize(This, This->length + inCells))
       return NULL;
   }
 
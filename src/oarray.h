@@ -48,4 +48,6 @@ void __glcArrayRemove(__GLCarray* This, const int inRank);
 void* __glcArrayInsertCell(__GLCarray* This, const int inRank,
 			   const int inCells);
 __GLCarray* __glcArrayDuplicate(__GLCarray* This);
+__GLCarray* __glcArrayReserve(__GLCarray* This, const int inCount);
+void __glcArrayShrink(__GLCarray* This);
 #endif
@@ -57,123 +57,46 @@ __GLCcharMap* __glcCharMapCreate(const __GLCmaster* inMaster,
   }
 
   if (inMaster) {
-    FcCharSet* charSet = NULL;
-    FcFontSet* fontSet = NULL;
+    /* The character set of the master is the union of the character sets of
+     * all its fonts : the faces of the master index only keep one font per
+     * style hence the fonts which share a style are also looked up.
+     */
+    const GLint count = __glcMasterFontCount(inMaster, inContext);
     int i = 0;
-    FcObjectSet* objectSet = NULL;
-    FcPattern* pattern = FcPatternCreate();
-
-    if (!pattern) {
-      __glcRaiseError(GLC_RESOURCE_ERROR);
-      FcCharSetDestroy(This->charSet);
-      __glcFree(This);
-      return NULL;
-    }
 
-    objectSet = FcObjectSetBuild(FC_FAMILY, FC_FOUNDRY, FC_SPACING, FC_OUTLINE,
-				 FC_CHARSET, NULL);
-    if (!objectSet) {
-      __glcRaiseError(GLC_RESOURCE_ERROR);
-      FcPatternDestroy(pattern);
-      FcCharSetDestroy(This->charSet);
-      __glcFree(This);
-      return NULL;
-    }
-
-    fontSet = FcFontList(inContext->config, pattern, objectSet);
-    FcObjectSetDestroy(objectSet);
-    FcPatternDestroy(pattern);
-    if (!fontSet) {
-      __glcRaiseError(GLC_RESOURCE_ERROR);
-      FcCharSetDestroy(This->charSet);
-      __glcFree(This);
-      return NULL;
-    }
-
-    for (i = 0; i < fontSet->nfont; i++) {
-      FcChar8* family = NULL;
-      int fixed = 0;
-      FcChar8* foundry = NULL;
-      FcBool outline = FcFalse;
-      FcBool equal = FcFalse;
+    for (i = 0; i < count; i++) {
+      FcPattern* font = __glcMasterGetFontPatternByIndex(inMaster, inContext,
+							  i);
+      FcCharSet* charSet = NULL;
+      FcCharSet* newCharSet = NULL;
 #ifdef DEBUGMODE
       FcResult result = FcResultMatch;
-
-      result = FcPatternGetBool(fontSet->fonts[i], FC_OUTLINE, 0, &outline);
-      assert(result != FcResultTypeMismatch);
-#else
-      FcPatternGetBool(fontSet->fonts[i], FC_OUTLINE, 0, &outline);
 #endif
 
-      /* Check whether the glyphs are outlines */
-      if (!outline)
-	continue;
+      if (!font) {
+	FcCharSetDestroy(This->charSet);
+	__glcFree(This);
+	return NULL;
+      }
 
 #ifdef DEBUGMODE
-      result = FcPatternGetString(fontSet->fonts[i], FC_FAMILY, 0, &family);
-      assert(result != FcResultTypeMismatch);
-      result = FcPatternGetString(fontSet->fonts[i], FC_FOUNDRY, 0, &foundry);
-      assert(result != FcResultTypeMismatch);
-      result = FcPatternGetInteger(fontSet->fonts[i], FC_SPACING, 0, &fixed);
+      result = FcPatternGetCharSet(font, FC_CHARSET, 0, &charSet);
       assert(result != FcResultTypeMismatch);
 #else
-      FcPatternGetString(fontSet->fonts[i], FC_FAMILY, 0, &family);
-      FcPatternGetString(fontSet->fonts[i], FC_FOUNDRY, 0, &foundry);
-      FcPatternGetInteger(fontSet->fonts[i], FC_SPACING, 0, &fixed);
+      FcPatternGetCharSet(font, FC_CHARSET, 0, &charSet);
 #endif
 
-      if (foundry)
-	pattern = FcPatternBuild(NULL, FC_FAMILY, FcTypeString, family,
-				 FC_FOUNDRY, FcTypeString, foundry, FC_SPACING,
-				 FcTypeInteger, fixed, NULL);
-      else
-	pattern = FcPatternBuild(NULL, FC_FAMILY, FcTypeString, family,
-				 FC_SPACING, FcTypeInteger, fixed, NULL);
-
-      if (!pattern) {
+      newCharSet = FcCharSetUnion(This->charSet, charSet);
+      if (!newCharSet) {
 	__glcRaiseError(GLC_RESOURCE_ERROR);
 	FcCharSetDestroy(This->charSet);
-	FcFontSetDestroy(fontSet);
 	__glcFree(This);
 	return NULL;
       }
 
-      equal = FcPatternEqual(pattern, inMaster->pattern);
-      FcPatternDestroy(pattern);
-      if (equal) {
-        FcCharSet* newCharSet = NULL;
-
-#ifdef DEBUGMODE
-        result = FcPatternGetCharSet(fontSet->fonts[i], FC_CHARSET, 0,
-				     &charSet);
-        assert(result != FcResultTypeMismatch);
-#else
-	FcPatternGetCharSet(fontSet->fonts[i], FC_CHARSET, 0, &charSet);
-#endif
-
-        newCharSet = FcCharSetUnion(This->charSet, charSet);
-	if (!newCharSet) {
-          __glcRaiseError(GLC_RESOURCE_ERROR);
-          FcCharSetDestroy(This->charSet);
-          FcFontSetDestroy(fontSet);
-          __glcFree(This);
-          return NULL;
-	}
-
-	FcCharSetDestroy(This->charSet);
-	This->charSet = newCharSet;
-      }
+      FcCharSetDestroy(This->charSet);
+      This->charSet = newCharSet;
     }
-
-    FcFontSetDestroy(fontSet);
-  }
-
-  /* The array 'map' will contain the actual character map */
-  This->map = __glcArrayCreate(sizeof(__GLCcharMapElement));
-  if (!This->map) {
-    FcCharSetDestroy(This->charSet);
-    __glcFree(This);
-    return NULL;
   }
 
   return This;
@@ -184,8 +107,17 @@ __GLCcharMap* __glcCharMapCreate(const __GLCmaster* inMaster,
 /* Destructor of the object */
 void __glcCharMapDestroy(__GLCcharMap* This)
 {
-  if (This->map)
-    __glcArrayDestroy(This->map);
+  int i = 0;
+
+  for (i = 0; i < This->pageCount; i++) {
+    if (This->pages[i])
+      __glcFree(This->pages[i]);
+  }
+  if (This->pages)
+    __glcFree(This->pages);
+
+  if (This->blocks)
+    __glcArrayDestroy(This->blocks);
 
   FcCharSetDestroy(This->charSet);
 
@@ -200,52 +132,43 @@ void __glcCharMapDestroy(__GLCcharMap* This)
 void __glcCharMapAddChar(__GLCcharMap* This, const GLint inCode,
 			 __GLCglyph* inGlyph)
 {
-  __GLCcharMapElement* element = NULL;
-  __GLCcharMapElement* newElement = NULL;
-  int start = 0, middle = 0, end = 0;
+  const GLint page = inCode >> 8;
 
   assert(This);
-  assert(This->map);
-  assert(GLC_ARRAY_DATA(This->map));
   assert(inCode >= 0);
 
-  /* Characters are stored by ascending order of their mapped code */
-  element = (__GLCcharMapElement*)GLC_ARRAY_DATA(This->map);
+  if (inCode > GLC_CHAR_MAP_MAX_CODE) {
+    __glcRaiseError(GLC_PARAMETER_ERROR);
+    return;
+  }
 
-  end = GLC_ARRAY_LENGTH(This->map) - 1;
+  /* Extend the directory up to the page of 'inCode' */
+  if (page >= This->pageCount) {
+    __GLCglyph*** pages = (__GLCglyph***)__glcRealloc(This->pages,
+						(page + 1) * sizeof(__GLCglyph**));
 
-  /* Parse the array by dichotomy to look for the place where to add the new
-   * character.
-   */
-  while (start <= end) {
-    middle = (start + end) >> 1;
-    /* If the character map already contains the new character then update the
-     * glyph then return.
-     */
-    if (element[middle].mappedCode == (GLCulong)inCode) {
-      element[middle].glyph = inGlyph;
+    if (!pages) {
+      __glcRaiseError(GLC_RESOURCE_ERROR);
       return;
     }
-    else if (element[middle].mappedCode > (GLCulong)inCode)
-      end = middle - 1;
-    else
-      start = middle + 1;
+    memset(pages + This->pageCount, 0,
+	   (page + 1 - This->pageCount) * sizeof(__GLCglyph**));
+    This->pages = pages;
+    This->pageCount = page + 1;
   }
 
-  /* If we have reached the end of the array then update the rank 'middle'
-   * accordingly.
-   */
-  if ((end >= 0) && (element[middle].mappedCode < (GLCulong)inCode))
-    middle++;
-
-  /* Insert the new character in the character map */
-  newElement = (__GLCcharMapElement*)__glcArrayInsertCell(This->map, middle, 1);
-  if (!newElement)
-    return;
+  /* Allocate the page of 'inCode' if needed */
+  if (!This->pages[page]) {
+    This->pages[page] = (__GLCglyph**)__glcMalloc(GLC_CHAR_MAP_PAGE_SIZE
+						  * sizeof(__GLCglyph*));
+    if (!This->pages[page]) {
+      __glcRaiseError(GLC_RESOURCE_ERROR);
+      return;
+    }
+    memset(This->pages[page], 0, GLC_CHAR_MAP_PAGE_SIZE * sizeof(__GLCglyph*));
+  }
 
-  newElement->mappedCode = inCode;
-  newElement->glyph = inGlyph;
-  return;
+  This->pages[page][inCode & (GLC_CHAR_MAP_PAGE_SIZE - 1)] = inGlyph;
 }
 
 
@@ -253,34 +176,13 @@ void __glcCharMapAddChar(__GLCcharMap* This, const GLint inCode,
 /* Remove a character from the character map */
 void __glcCharMapRemoveChar(__GLCcharMap* This, const GLint inCode)
 {
-  __GLCcharMapElement* element = NULL;
-  int start = 0, middle = 0, end = 0;
+  const GLint page = inCode >> 8;
 
   assert(This);
-  assert(This->map);
-  assert(GLC_ARRAY_DATA(This->map));
   assert(inCode >= 0);
 
-  /* Characters are stored by ascending order of their mapped code */
-  element = (__GLCcharMapElement*)GLC_ARRAY_DATA(This->map);
-
-  end = GLC_ARRAY_LENGTH(This->map) - 1;
-
-  /* Parse the array by dichotomy to look for the place where to add the new
-   * character.
-   */
-  while (start <= end) {
-    middle = (start + end) >> 1;
-    /* When the character is found remove it from the array and return */
-    if (element[middle].mappedCode == (GLCulong)inCode) {
-      __glcArrayRemove(This->map, middle);
-      break;
-    }
-    else if (element[middle].mappedCode > (GLCulong)inCode)
-      end = middle - 1;
-    else
-      start = middle + 1;
-  }
+  if ((page < This->pageCount) && This->pages[page])
+    This->pages[page][inCode & (GLC_CHAR_MAP_PAGE_SIZE - 1)] = NULL;
 }
 
 
@@ -293,34 +195,12 @@ void __glcCharMapRemoveChar(__GLCcharMap* This, const GLint inCode)
 const GLCchar8* __glcCharMapGetCharName(const __GLCcharMap* This,
 					const GLint inCode)
 {
-  __GLCcharMapElement* element = NULL;
-  int start = 0, middle = 0, end = 0;
+  __GLCglyph* glyph = __glcCharMapGetGlyph(This, inCode);
   GLint code = 0;
 
-  assert(This);
-  assert(This->map);
-  assert(GLC_ARRAY_DATA(This->map));
-  assert(inCode >= 0);
-
-  /* Characters are stored by ascending order of their mapped code */
-  element = (__GLCcharMapElement*)GLC_ARRAY_DATA(This->map);
-
-  end = GLC_ARRAY_LENGTH(This->map) - 1;
-
-  /* Parse the array by dichotomy to look for the Unicode codepoint that the
-   * request character maps to.
-   */
-  while (start <= end) {
-    middle = (start + end) >> 1;
-    if (element[middle].mappedCode == (GLCulong)inCode) {
-      code = element[middle].glyph->codepoint;
-      break;
-    }
-    else if (element[middle].mappedCode > (GLCulong)inCode)
-      end = middle - 1;
-    else
-      start = middle + 1;
-  }
+  /* Get the Unicode codepoint that the requested character maps to */
+  if (glyph)
+    code = glyph->codepoint;
 
   if (!code) {
     if (FcCharSetHasChar(This->charSet, inCode))
@@ -334,85 +214,186 @@ const GLCchar8* __glcCharMapGetCharName(const __GLCcharMap* This,
 
 
 
-/* Get the glyph corresponding to codepoint 'inCode' */
-__GLCglyph* __glcCharMapGetGlyph(const __GLCcharMap* This, const GLint inCode)
+/* Check if a character is in the character map */
+GLboolean __glcCharMapHasChar(const __GLCcharMap* This, const GLint inCode)
 {
-  __GLCcharMapElement* element = NULL;
-  int start = 0, middle = 0, end = 0;
+  /* The character has been found: return GL_TRUE */
+  if (__glcCharMapGetGlyph(This, inCode))
+    return GL_TRUE;
+
+  /* Check if the character identified by inCode exists in the font */
+  return FcCharSetHasChar(This->charSet, inCode);
+}
+
+
+
+/* This function counts the number of bits that are set in c1. GCC builtin is
+ * used when available since it is compiled to a single instruction on the
+ * processors which support it. Otherwise the code is copied from Keith
+ * Packard's Fontconfig.
+ */
+#ifdef __GNUC__
+#define __glcCharSetPopCount(c1) ((GLCchar32)__builtin_popcount(c1))
+#else
+static GLCchar32 __glcCharSetPopCount(const GLCchar32 c1)
+{
+  /* hackmem 169 */
+  GLCchar32    c2 = (c1 >> 1) & 033333333333;
+  c2 = c1 - c2 - ((c2 >> 1) & 033333333333);
+  return (((c2 + (c2 >> 3)) & 030707070707) % 077);
+}
+#endif
+
+
+
+/* Build the rank index of the FcCharSet of the character map.
+ *
+ * In Fontconfig the map in FcCharSet is organized as an array of integers.
+ * Each integer corresponds to a page of 32 characters (since it uses 32 bits
+ * integer). If a bit is set then the corresponding character is in the
+ * character map otherwise it is not.
+ * In order not to store pages of 0's, the character map begins at the
+ * character which codepoint is 'base'.
+ * Pages are also gathered in blocks of 'FC_CHARSET_MAP_SIZE' pages in order
+ * to prevent Fontconfig to store heaps of 0's if the character codes are
+ * sparsed.
+ *
+ * The codepoint of a character located at bit 'j' of page 'i' is:
+ * 'base + (i << 5) + j'.
+ *
+ * The blocks are copied once for all in the array 'blocks' along with the
+ * number of characters located in the preceding blocks so that the character
+ * at a given rank can be found by dichotomy. The index is built the first
+ * time it is needed since most of the character maps are never enumerated.
+ */
+static __GLCarray* __glcCharMapGetBlocks(__GLCcharMap* This)
+{
+  __GLCcharMapBlock block;
+  GLCchar32 next = 0;
+  int i = 0;
 
   assert(This);
-  assert(This->map);
-  assert(GLC_ARRAY_DATA(This->map));
-  assert(inCode >= 0);
+  assert(This->charSet);
 
-  /* Characters are stored by ascending order of their mapped code */
-  element = (__GLCcharMapElement*)GLC_ARRAY_DATA(This->map);
+  if (This->blocks)
+    return This->blocks;
 
-  end = GLC_ARRAY_LENGTH(This->map) - 1;
+  This->blocks = __glcArrayCreate(sizeof(__GLCcharMapBlock));
+  if (!This->blocks)
+    return NULL;
 
-  /* Parse the array by dichotomy to find the glyph of the requested
-   * character.
-   */
-  while (start <= end) {
-    middle = (start + end) >> 1;
-    if (element[middle].mappedCode == (GLCulong)inCode)
-      /* When the character is found return the corresponding glyph */
-      return element[middle].glyph;
-    else if (element[middle].mappedCode > (GLCulong)inCode)
-      end = middle - 1;
-    else
-      start = middle + 1;
+  block.rank = 0;
+  block.base = FcCharSetFirstPage(This->charSet, block.map, &next);
+
+  while (block.base != FC_CHARSET_DONE) {
+    if (!__glcArrayAppend(This->blocks, &block)) {
+      __glcArrayDestroy(This->blocks);
+      This->blocks = NULL;
+      return NULL;
+    }
+
+    for (i = 0; i < FC_CHARSET_MAP_SIZE; i++)
+      block.rank += __glcCharSetPopCount(block.map[i]);
+
+    block.base = FcCharSetNextPage(This->charSet, block.map, &next);
   }
 
-  /* No glyph has been defined yet for the requested character */
-  return NULL;
+  /* The index is not modified afterwards */
+  __glcArrayShrink(This->blocks);
+
+  return This->blocks;
 }
 
 
 
-/* Check if a character is in the character map */
-GLboolean __glcCharMapHasChar(const __GLCcharMap* This, const GLint inCode)
+/* Store in 'outCodes' the codepoints of the characters which are located from
+ * rank 'inIndex' to rank 'inIndex + inCount - 1' in the FcCharSet of the
+ * character map. The function returns the number of codepoints that have been
+ * stored which is lower than 'inCount' if the end of the character map has
+ * been reached.
+ */
+GLint __glcCharMapGetCodes(__GLCcharMap* This, const GLint inIndex,
+			   const GLint inCount, GLint* outCodes)
 {
-  __GLCcharMapElement* element = NULL;
+  __GLCarray* blocks = NULL;
+  __GLCcharMapBlock* block = NULL;
   int start = 0, middle = 0, end = 0;
+  int i = 0, j = 0;
+  GLint count = 0;
+  GLCchar32 rank = 0;
+  GLCchar32 page = 0;
 
   assert(This);
-  assert(This->map);
-  assert(GLC_ARRAY_DATA(This->map));
-  assert(inCode >= 0);
+  assert(outCodes || !inCount);
+
+  if ((inIndex < 0) || (inCount < 0)
+      || (inIndex >= __glcCharMapGetCount(This))) {
+    __glcRaiseError(GLC_PARAMETER_ERROR);
+    return 0;
+  }
 
-  /* Characters are stored by ascending order of their mapped code */
-  element = (__GLCcharMapElement*)GLC_ARRAY_DATA(This->map);
+  blocks = __glcCharMapGetBlocks(This);
+  if (!blocks)
+    return 0;
 
-  end = GLC_ARRAY_LENGTH(This->map) - 1;
+  block = (__GLCcharMapBlock*)GLC_ARRAY_DATA(blocks);
+  end = GLC_ARRAY_LENGTH(blocks) - 1;
 
-  /* Parse the array by dichotomy to find the requested character. */
-  while (start <= end) {
-    middle = (start + end) >> 1;
-    /* The character has been found: return GL_TRUE */
-    if (element[middle].mappedCode == (GLCulong)inCode)
-      return GL_TRUE;
-    else if (element[middle].mappedCode > (GLCulong)inCode)
+  /* Look by dichotomy for the last block which rank is lower than or equal to
+   * 'inIndex'.
+   */
+  while (start < end) {
+    middle = (start + end + 1) >> 1;
+    if (block[middle].rank > (GLCchar32)inIndex)
       end = middle - 1;
     else
-      start = middle + 1;
+      start = middle;
   }
 
-  /* Check if the character identified by inCode exists in the font */
-  return FcCharSetHasChar(This->charSet, inCode);
-}
+  block += start;
+  rank = inIndex - block->rank;
 
+  /* Look for the page which contains the character of rank 'inIndex' */
+  for (i = 0; i < FC_CHARSET_MAP_SIZE; i++) {
+    GLCchar32 value = __glcCharSetPopCount(block->map[i]);
 
+    if (rank < value)
+      break;
+    rank -= value;
+  }
 
-/* This function counts the number of bits that are set in c1
- * Copied from Keith Packard's Fontconfig
- */
-static GLCchar32 __glcCharSetPopCount(const GLCchar32 c1)
-{
-  /* hackmem 169 */
-  GLCchar32    c2 = (c1 >> 1) & 033333333333;
-  c2 = c1 - c2 - ((c2 >> 1) & 033333333333);
-  return (((c2 + (c2 >> 3)) & 030707070707) % 077);
+  assert(i < FC_CHARSET_MAP_SIZE);
+
+  /* Clear the bits of the characters that are located before the rank
+   * 'inIndex' in the page.
+   */
+  page = block->map[i];
+  for (; rank; rank--)
+    page &= page - 1;
+
+  /* Enumerate the characters */
+  while (count < inCount) {
+    while (!page) {
+      if (++i == FC_CHARSET_MAP_SIZE) {
+	block++;
+	if (block == (__GLCcharMapBlock*)GLC_ARRAY_DATA(blocks)
+	    + GLC_ARRAY_LENGTH(blocks))
+	  return count;
+	i = 0;
+      }
+      page = block->map[i];
+    }
+
+#ifdef __GNUC__
+    j = __builtin_ctz(page);
+#else
+    for (j = 0; !((page >> j) & 1); j++);
+#endif
+    outCodes[count++] = block->base + (i << 5) + j;
+    page &= page - 1;
+  }
+
+  return count;
 }
 
 
@@ -420,68 +401,17 @@ static GLCchar32 __glcCharSetPopCount(const GLCchar32 c1)
 /* Get the name of the character which is stored at rank 'inIndex' in the
  * FcCharSet of the face.
  */
-const GLCchar8* __glcCharMapGetCharNameByIndex(const __GLCcharMap* This,
+const GLCchar8* __glcCharMapGetCharNameByIndex(__GLCcharMap* This,
 					       const GLint inIndex)
 {
-  int i = 0;
-  int j = 0;
-
-  /* In Fontconfig the map in FcCharSet is organized as an array of integers.
-   * Each integer corresponds to a page of 32 characters (since it uses 32 bits
-   * integer). If a bit is set then the corresponding character is in the
-   * character map otherwise it is not.
-   * In order not to store pages of 0's, the character map begins at the
-   * character which codepoint is 'base'.
-   * Pages are also gathered in blocks of 'FC_CHARSET_MAP_SIZE' pages in order
-   * to prevent Fontconfig to store heaps of 0's if the character codes are
-   * sparsed.
-   *
-   * The codepoint of a character located at bit 'j' of page 'i' is:
-   * 'base + (i << 5) + j'.
-   */
-  GLCchar32 map[FC_CHARSET_MAP_SIZE];
-  GLCchar32 next = 0;
-  GLCchar32 base = 0;
-  GLCchar32 count = 1;
-  GLCchar32 value = 0;
+  GLint code = 0;
 
   assert(This);
-  assert(inIndex >= 0);
-
-  base = FcCharSetFirstPage(This->charSet, map, &next);
 
-  do {
-    /* Parse the pages in FcCharSet */
-    for (i = 0; i < FC_CHARSET_MAP_SIZE; i++) {
-      /* Get the number of character located in the current page */
-      value = __glcCharSetPopCount(map[i]);
-
-      /* Check if the character we are looking for is in the current page */
-      if (count + value >= (GLCchar32)inIndex) {
-	for (j = 0; j < 32; j++) {
-	  /* Parse the page bit by bit */
-	  if ((map[i] >> j) & 1) {
-	    count++; /* A character is set at bit j */
-	    /* Check if we have reached the rank inIndex */
-	    if (count == (GLCchar32)inIndex) {
-	      /* Get the character name */
-	      return __glcGetNameFromCode(base + (i << 5) + j);
-	    }
-	  }
-	}
-      }
-      /* Add the number of characters of the current page to the count and
-       * check the next page.
-       */
-      count += value;
-    }
-    /* The current block is finished, check the next one */
-    base = FcCharSetNextPage(This->charSet, map, &next);
-  } while (base != FC_CHARSET_DONE);
+  if (!__glcCharMapGetCodes(This, inIndex, 1, &code))
+    return GLC_NONE;
 
-  /* The character has not been found */
-  __glcRaiseError(GLC_PARAMETER_ERROR);
-  return GLC_NONE;
+  return __glcGetNameFromCode(code);
 }
 
 
@@ -495,12 +425,8 @@ GLint __glcCharMapGetMaxMappedCode(const __GLCcharMap* This)
   GLCchar32 map[FC_CHARSET_MAP_SIZE];
   int i = 0, j = 0;
   GLCulong maxMappedCode = 0;
-  __GLCcharMapElement* element = NULL;
-  int length = 0;
 
   assert(This);
-  assert(This->map);
-  assert(GLC_ARRAY_DATA(This->map));
 
   /* Look for the last block of pages of the FcCharSet structure */
   base = FcCharSetFirstPage(This->charSet, map, &next);
@@ -532,17 +458,24 @@ GLint __glcCharMapGetMaxMappedCode(const __GLCcharMap* This)
   maxMappedCode = prev_base + (i << 5) + j;
 
   /* Check that a code greater than the one found in the FcCharSet is not
-   * stored in the array 'map'.
+   * stored in the pages of glyphs.
    */
-  element = (__GLCcharMapElement*)GLC_ARRAY_DATA(This->map);
-  length = GLC_ARRAY_LENGTH(This->map);
-
-  /* Return the greater of the code of both the FcCharSet and the array 'map'*/
-  if (length)
-    return element[length-1].mappedCode > maxMappedCode ?
-      element[length-1].mappedCode : maxMappedCode;
-  else
-    return maxMappedCode;
+  for (i = This->pageCount - 1; i >= 0; i--) {
+    if ((GLCulong)(i + 1) * GLC_CHAR_MAP_PAGE_SIZE <= maxMappedCode)
+      break;
+    if (!This->pages[i])
+      continue;
+
+    for (j = GLC_CHAR_MAP_PAGE_SIZE - 1; j >= 0; j--) {
+      if (This->pages[i][j]) {
+	GLCulong code = (GLCulong)i * GLC_CHAR_MAP_PAGE_SIZE + j;
+
+	return code > maxMappedCode ? code : maxMappedCode;
+      }
+    }
+  }
+
+  return maxMappedCode;
 }
 
 
@@ -555,12 +488,8 @@ GLint __glcCharMapGetMinMappedCode(const __GLCcharMap* This)
   GLCchar32 map[FC_CHARSET_MAP_SIZE];
   int i = 0, j = 0;
   GLCulong minMappedCode = 0xffffffff;
-  __GLCcharMapElement* element = NULL;
-  int length = 0;
 
   assert(This);
-  assert(This->map);
-  assert(GLC_ARRAY_DATA(This->map));
 
   /* Get the first block of pages of the FcCharSet structure */
   base = FcCharSetFirstPage(This->charSet, map, &next);
@@ -573,7 +502,7 @@ GLint __glcCharMapGetMinMappedCode(const __GLCcharMap* This)
     if (map[i]) break;
 
   /* If the map contains no char then something went wrong... */
-  assert(i >= 0);
+  assert(i < FC_CHARSET_MAP_SIZE);
 
   /* Parse the bits of the first page in ascending order to find the first
    * character of the page
@@ -585,15 +514,22 @@ GLint __glcCharMapGetMinMappedCode(const __GLCcharMap* This)
   minMappedCode = base + (i << 5) + j;
 
   /* Check that a code lower than the one found in the FcCharSet is not
-   * stored in the array 'map'.
+   * stored in the pages of glyphs.
    */
-  element = (__GLCcharMapElement*)GLC_ARRAY_DATA(This->map);
-  length = GLC_ARRAY_LENGTH(This->map);
-
-  /* Return the lower of the code of both the FcCharSet and the array 'map'*/
-  if (length)
-    return element[0].mappedCode < minMappedCode ?
-      element[0].mappedCode : minMappedCode;
-  else
-    return minMappedCode;
+  for (i = 0; i < This->pageCount; i++) {
+    if ((GLCulong)i * GLC_CHAR_MAP_PAGE_SIZE >= minMappedCode)
+      break;
+    if (!This->pages[i])
+      continue;
+
+    for (j = 0; j < GLC_CHAR_MAP_PAGE_SIZE; j++) {
+      if (This->pages[i][j]) {
+	GLCulong code = (GLCulong)i * GLC_CHAR_MAP_PAGE_SIZE + j;
+
+	return code < minMappedCode ? code : minMappedCode;
+      }
+    }
+  }
+
+  return minMappedCode;
 }
@@ -29,18 +29,32 @@
 #include "ocontext.h"
 #include "oglyph.h"
 
-typedef struct __GLCcharMapElementRec __GLCcharMapElement;
+typedef struct __GLCcharMapBlockRec __GLCcharMapBlock;
 typedef struct __GLCcharMapRec __GLCcharMap;
 typedef struct __GLCmasterRec __GLCmaster;
 
-struct __GLCcharMapElementRec {
-  GLCulong mappedCode;
-  __GLCglyph* glyph;
+/* The glyphs of the character map are stored in pages of
+ * GLC_CHAR_MAP_PAGE_SIZE consecutive codes which are allocated on demand. The
+ * page of the code 'c' is 'pages[c >> 8]' and its glyph is stored at the rank
+ * 'c & 0xff' of the page.
+ */
+#define GLC_CHAR_MAP_PAGE_SIZE 256
+#define GLC_CHAR_MAP_MAX_CODE  0x10ffff
+
+/* Block of FC_CHARSET_MAP_SIZE pages of the FcCharSet along with the number
+ * of characters that are located in the preceding blocks.
+ */
+struct __GLCcharMapBlockRec {
+  GLCchar32 base;
+  GLCchar32 rank;
+  GLCchar32 map[FC_CHARSET_MAP_SIZE];
 };
 
 struct __GLCcharMapRec {
   FcCharSet* charSet;
-  __GLCarray* map;
+  __GLCglyph*** pages; /* Directory of the pages of glyphs */
+  GLint pageCount;     /* Number of entries of the directory */
+  __GLCarray* blocks; /* Rank index of 'charSet', built on demand */
 };
 
 __GLCcharMap* __glcCharMapCreate(const __GLCmaster* inMaster,
@@ -51,10 +65,33 @@ void __glcCharMapAddChar(__GLCcharMap* This, const GLint inCode,
 void __glcCharMapRemoveChar(__GLCcharMap* This, const GLint inCode);
 const GLCchar8* __glcCharMapGetCharName(const __GLCcharMap* This,
 					const GLint inCode);
-__GLCglyph* __glcCharMapGetGlyph(const __GLCcharMap* This, const GLint inCode);
+/* Get the glyph corresponding to codepoint 'inCode' */
+#ifdef _MSC_VER
+static __GLCglyph* __glcCharMapGetGlyph(const __GLCcharMap* This,
+					const GLint inCode)
+#else
+static inline __GLCglyph* __glcCharMapGetGlyph(const __GLCcharMap* This,
+					       const GLint inCode)
+#endif
+{
+  const GLCchar32 page = (GLCchar32)inCode >> 8;
+
+  assert(This);
+  assert(inCode >= 0);
+
+  /* No glyph has been defined yet for the requested character if its page
+   * has not been allocated.
+   */
+  if ((page >= (GLCchar32)This->pageCount) || !This->pages[page])
+    return NULL;
+
+  return This->pages[page][inCode & (GLC_CHAR_MAP_PAGE_SIZE - 1)];
+}
 GLboolean __glcCharMapHasChar(const __GLCcharMap* This, const GLint inCode);
-const GLCchar8* __glcCharMapGetCharNameByIndex(const __GLCcharMap* This,
+const GLCchar8* __glcCharMapGetCharNameByIndex(__GLCcharMap* This,
 					       const GLint inIndex);
+GLint __glcCharMapGetCodes(__GLCcharMap* This, const GLint inIndex,
+			   const GLint inCount, GLint* outCodes);
 /* Return the number of characters in the character map */
 #ifdef _MSC_VER
 static GLint __glcCharMapGetCount(const __GLCcharMap* This)
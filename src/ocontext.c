@@ -41,6 +41,13 @@ __GLCthreadArea* __glcThreadArea = NULL;
 #endif
 
 static GLboolean __glcContextUpdateHashTable(__GLCcontext *This);
+static void __glcContextDestroyMasterIndex(__GLCcontext *This);
+static void __glcContextReleaseConfig(__GLCcontext *This);
+static GLboolean __glcContextPrivatizeConfig(__GLCcontext *This);
+static void __glcContextDestroyCatalogList(__GLCarray* inList);
+static void __glcContextJoinLoader(__GLCcatalogLoader *inLoader);
+static void __glcContextDestroyLoader(__GLCcatalogLoader *inLoader);
+static void __glcContextClearCatalogRequests(__GLCcontext *This);
 
 
 
@@ -100,8 +107,16 @@ __GLCcontext* __glcContextCreate(const GLint inContext)
   }
 #endif
 
+  /* The Fontconfig configuration is shared by all the contexts until a
+   * context modifies its catalogs.
+   */
   __glcLock();
-  This->config = FcInitLoadConfigAndFonts();
+  if (!__glcCommonArea.sharedConfig)
+    __glcCommonArea.sharedConfig = FcInitLoadConfigAndFonts();
+  if (__glcCommonArea.sharedConfig) {
+    __glcCommonArea.sharedConfigRefCount++;
+    This->config = __glcCommonArea.sharedConfig;
+  }
   __glcUnlock();
   if (!This->config) {
     __glcRaiseError(GLC_RESOURCE_ERROR);
@@ -119,7 +134,7 @@ __GLCcontext* __glcContextCreate(const GLint inContext)
     FTC_Manager_Done(This->cache);
 #endif
     FT_Done_Library(This->library);
-    FcConfigDestroy(This->config);
+    __glcContextReleaseConfig(This);
     __glcFree(This);
     return NULL;
   }
@@ -131,7 +146,7 @@ __GLCcontext* __glcContextCreate(const GLint inContext)
     FTC_Manager_Done(This->cache);
 #endif
     FT_Done_Library(This->library);
-    FcConfigDestroy(This->config);
+    __glcContextReleaseConfig(This);
     __glcFree(This);
     return NULL;
   }
@@ -143,7 +158,7 @@ __GLCcontext* __glcContextCreate(const GLint inContext)
     FTC_Manager_Done(This->cache);
 #endif
     FT_Done_Library(This->library);
-    FcConfigDestroy(This->config);
+    __glcContextReleaseConfig(This);
     __glcFree(This);
     return NULL;
   }
@@ -168,22 +183,26 @@ __GLCcontext* __glcContextCreate(const GLint inContext)
   This->enableState.hinting = GL_FALSE;
   This->enableState.extrude = GL_FALSE;
   This->enableState.kerning = GL_FALSE;
+  This->enableState.preloadMetrics = GL_FALSE;
+  This->enableState.asyncCatalog = GL_FALSE;
   This->renderState.resolution = 72.;
   This->renderState.renderStyle = GLC_BITMAP;
   This->renderState.tolerance = 0.005;
+  This->renderState.atlasPageBudget = GLC_ATLAS_PAGE_BUDGET;
   This->bitmapMatrixStackDepth = 1;
   This->bitmapMatrix = This->bitmapMatrixStack;
   This->bitmapMatrix[0] = 1.;
   This->bitmapMatrix[3] = 1.;
   This->measurementBuffer = __glcArrayCreate(12 * sizeof(GLfloat));
   if (!This->measurementBuffer) {
+    __glcContextDestroyMasterIndex(This);
     __glcArrayDestroy(This->masterHashTable);
     __glcArrayDestroy(This->catalogList);
 #ifdef GLC_FT_CACHE
     FTC_Manager_Done(This->cache);
 #endif
     FT_Done_Library(This->library);
-    FcConfigDestroy(This->config);
+    __glcContextReleaseConfig(This);
     __glcFree(This);
     return NULL;
   }
@@ -191,13 +210,14 @@ __GLCcontext* __glcContextCreate(const GLint inContext)
   This->vertexArray = __glcArrayCreate(2 * sizeof(GLfloat));
   if (!This->vertexArray) {
     __glcArrayDestroy(This->measurementBuffer);
+    __glcContextDestroyMasterIndex(This);
     __glcArrayDestroy(This->masterHashTable);
     __glcArrayDestroy(This->catalogList);
 #ifdef GLC_FT_CACHE
     FTC_Manager_Done(This->cache);
 #endif
     FT_Done_Library(This->library);
-    FcConfigDestroy(This->config);
+    __glcContextReleaseConfig(This);
     __glcFree(This);
     return NULL;
   }
@@ -205,13 +225,14 @@ __GLCcontext* __glcContextCreate(const GLint inContext)
   if (!This->controlPoints) {
     __glcArrayDestroy(This->vertexArray);
     __glcArrayDestroy(This->measurementBuffer);
+    __glcContextDestroyMasterIndex(This);
     __glcArrayDestroy(This->masterHashTable);
     __glcArrayDestroy(This->catalogList);
 #ifdef GLC_FT_CACHE
     FTC_Manager_Done(This->cache);
 #endif
     FT_Done_Library(This->library);
-    FcConfigDestroy(This->config);
+    __glcContextReleaseConfig(This);
     __glcFree(This);
     return NULL;
   }
@@ -220,13 +241,14 @@ __GLCcontext* __glcContextCreate(const GLint inContext)
     __glcArrayDestroy(This->controlPoints);
     __glcArrayDestroy(This->vertexArray);
     __glcArrayDestroy(This->measurementBuffer);
+    __glcContextDestroyMasterIndex(This);
     __glcArrayDestroy(This->masterHashTable);
     __glcArrayDestroy(This->catalogList);
 #ifdef GLC_FT_CACHE
     FTC_Manager_Done(This->cache);
 #endif
     FT_Done_Library(This->library);
-    FcConfigDestroy(This->config);
+    __glcContextReleaseConfig(This);
     __glcFree(This);
     return NULL;
   }
@@ -237,13 +259,14 @@ __GLCcontext* __glcContextCreate(const GLint inContext)
     __glcArrayDestroy(This->controlPoints);
     __glcArrayDestroy(This->vertexArray);
     __glcArrayDestroy(This->measurementBuffer);
+    __glcContextDestroyMasterIndex(This);
     __glcArrayDestroy(This->masterHashTable);
     __glcArrayDestroy(This->catalogList);
 #ifdef GLC_FT_CACHE
     FTC_Manager_Done(This->cache);
 #endif
     FT_Done_Library(This->library);
-    FcConfigDestroy(This->config);
+    __glcContextReleaseConfig(This);
     __glcFree(This);
     return NULL;
   }
@@ -255,13 +278,37 @@ __GLCcontext* __glcContextCreate(const GLint inContext)
     __glcArrayDestroy(This->controlPoints);
     __glcArrayDestroy(This->vertexArray);
     __glcArrayDestroy(This->measurementBuffer);
+    __glcContextDestroyMasterIndex(This);
     __glcArrayDestroy(This->masterHashTable);
     __glcArrayDestroy(This->catalogList);
 #ifdef GLC_FT_CACHE
     FTC_Manager_Done(This->cache);
 #endif
     FT_Done_Library(This->library);
-    FcConfigDestroy(This->config);
+    __glcContextReleaseConfig(This);
+    __glcFree(This);
+    return NULL;
+  }
+
+  /* The pages of the texture atlas are created when the first glyph is
+   * rendered with GLC_TEXTURE and GLC_GL_OBJECTS enabled.
+   */
+  This->atlasPages = __glcArrayCreate(sizeof(__GLCatlasPage));
+  if (!This->atlasPages) {
+    __glcArrayDestroy(This->geomBatches);
+    __glcArrayDestroy(This->vertexIndices);
+    __glcArrayDestroy(This->endContour);
+    __glcArrayDestroy(This->controlPoints);
+    __glcArrayDestroy(This->vertexArray);
+    __glcArrayDestroy(This->measurementBuffer);
+    __glcContextDestroyMasterIndex(This);
+    __glcArrayDestroy(This->masterHashTable);
+    __glcArrayDestroy(This->catalogList);
+#ifdef GLC_FT_CACHE
+    FTC_Manager_Done(This->cache);
+#endif
+    FT_Done_Library(This->library);
+    __glcContextReleaseConfig(This);
     __glcFree(This);
     return NULL;
   }
@@ -310,6 +357,12 @@ __GLCcontext* __glcContextCreate(const GLint inContext)
 #endif
     }
 
+    /* The catalogs are added to a private copy of the configuration */
+    if (path && !__glcContextPrivatizeConfig(This)) {
+      free(path);
+      path = NULL;
+    }
+
     if (path) {
       /* Get each path and add the corresponding masters to the current
        * context */
@@ -407,18 +460,20 @@ static void __glcFontDestructor(FT_Memory GLC_UNUSED_ARG(inMemory),
  */
 void __glcContextDestroy(__GLCcontext *This)
 {
-  int i = 0;
-
   assert(This);
 
-  /* Destroy the list of catalogs */
-  for (i = 0; i < GLC_ARRAY_LENGTH(This->catalogList); i++) {
-    GLCchar8* string = ((GLCchar8**)GLC_ARRAY_DATA(This->catalogList))[i];
-
-    assert(string);
-    free(string);
+  /* Wait for the catalog loader and discard the catalogs that it has loaded */
+  if (This->catalogLoader) {
+    __glcContextJoinLoader(This->catalogLoader);
+    __glcContextDestroyLoader(This->catalogLoader);
   }
-  __glcArrayDestroy(This->catalogList);
+  if (This->catalogRequests) {
+    __glcContextClearCatalogRequests(This);
+    __glcArrayDestroy(This->catalogRequests);
+  }
+
+  /* Destroy the list of catalogs */
+  __glcContextDestroyCatalogList(This->catalogList);
 
   /* Destroy GLC_CURRENT_FONT_LIST */
 #ifdef GLC_FT_CACHE
@@ -439,9 +494,38 @@ void __glcContextDestroy(__GLCcontext *This)
   if (This->masterHashTable)
     __glcArrayDestroy(This->masterHashTable);
 
+  __glcContextDestroyMasterIndex(This);
+
+  if (This->masterIDTable)
+    __glcFree(This->masterIDTable);
+
+  if (This->fontCache)
+    __glcFree(This->fontCache);
+
+  if (This->fontCacheHash)
+    __glcFree(This->fontCacheHash);
+
+  if (This->fallbackFontSet)
+    FcFontSetDestroy(This->fallbackFontSet);
+
+  if (This->unmappedCodes)
+    __glcFree(This->unmappedCodes);
+
   FT_List_Finalize(&This->atlasList, NULL,
 		   &__glcCommonArea.memoryManager, NULL);
 
+  __glcTextureAtlasDestroyPages(This);
+  __glcTextureCacheDestroy(This);
+
+  FT_List_Finalize(&This->bitmapList, NULL,
+		   &__glcCommonArea.memoryManager, NULL);
+
+  if (This->atlasVertices)
+    __glcArrayDestroy(This->atlasVertices);
+
+  if (This->atlasFreeQuads)
+    __glcArrayDestroy(This->atlasFreeQuads);
+
   if (This->bufferSize)
     __glcFree(This->buffer);
 
@@ -467,7 +551,7 @@ void __glcContextDestroy(__GLCcontext *This)
   FTC_Manager_Done(This->cache);
 #endif
   FT_Done_Library(This->library);
-  FcConfigDestroy(This->config);
+  __glcContextReleaseConfig(This);
   __glcFree(This);
 }
 
@@ -530,13 +614,218 @@ static GLboolean __glcCallCallbackFunc(__GLCcontext *inContext,
 
 
 
-/* Returns the ID of the first font in GLC_CURRENT_FONT_LIST that maps
- * 'inCode'. If there is no such font and GLC_AUTO_FONT is enabled, the
- * function attempts to append a new font from GLC_FONT_LIST (or from a master)
- * to GLC_CURRENT_FONT_LIST. If the attempt fails the function returns zero.
- * 'inCode' must be given in UCS-4 format.
+/* Hash function of the character codes that are stored in the hash table of
+ * the font cache.
  */
-__GLCfont* __glcContextGetFont(__GLCcontext *This, const GLint inCode)
+static GLCuint __glcContextHashCode(const GLint inCode)
+{
+  GLCuint key = (GLCuint)inCode;
+
+  key = ((key >> 16) ^ key) * 0x45d9f3b;
+  return (key >> 16) ^ key;
+}
+
+
+
+/* Get the bucket of the hash table of the font cache where the font of the
+ * character code 'inCode' is stored. If the code is not in the table, the
+ * function returns the empty bucket where it should be inserted.
+ */
+static __GLCfontCacheEntry* __glcContextLookupFontCache(__GLCcontext* This,
+							const GLint inCode)
+{
+  const GLCuint mask = This->fontCacheHashSize - 1;
+  __GLCfontCacheEntry* entry = NULL;
+
+  for (entry = This->fontCacheHash + (__glcContextHashCode(inCode) & mask);
+       entry->font && (entry->code != inCode);
+       entry = This->fontCacheHash + ((entry - This->fontCacheHash + 1) & mask));
+
+  return entry;
+}
+
+
+
+/* Double the number of buckets of the hash table of the font cache and store
+ * the entries again in the new table.
+ */
+static GLboolean __glcContextGrowFontCache(__GLCcontext* This)
+{
+  __GLCfontCacheEntry* oldTable = This->fontCacheHash;
+  const int oldSize = This->fontCacheHashSize;
+  const int size = oldSize ? oldSize << 1 : 64;
+  int i = 0;
+
+  This->fontCacheHash = (__GLCfontCacheEntry*)__glcMalloc(size
+					      * sizeof(__GLCfontCacheEntry));
+  if (!This->fontCacheHash) {
+    This->fontCacheHash = oldTable;
+    return GL_FALSE;
+  }
+
+  memset(This->fontCacheHash, 0, size * sizeof(__GLCfontCacheEntry));
+  This->fontCacheHashSize = size;
+
+  for (i = 0; i < oldSize; i++) {
+    if (oldTable[i].font)
+      *__glcContextLookupFontCache(This, oldTable[i].code) = oldTable[i];
+  }
+
+  if (oldTable)
+    __glcFree(oldTable);
+
+  return GL_TRUE;
+}
+
+
+
+/* Store in the font cache that 'inFont' is the first font of
+ * GLC_CURRENT_FONT_LIST that maps 'inCode'. The cache is only an accelerator:
+ * if memory can not be allocated, the code is simply not cached and no error
+ * is raised.
+ */
+static void __glcContextCacheFont(__GLCcontext* This, const GLint inCode,
+				  __GLCfont* inFont)
+{
+  __GLCfontCacheEntry* entry = NULL;
+
+  if ((inCode >= 0) && (inCode < GLC_FONT_CACHE_BMP_SIZE)) {
+    /* The codes of the BMP are directly mapped in a flat table */
+    if (!This->fontCache) {
+      This->fontCache = (__GLCfont**)__glcMalloc(GLC_FONT_CACHE_BMP_SIZE
+						 * sizeof(__GLCfont*));
+      if (!This->fontCache)
+	return;
+      memset(This->fontCache, 0, GLC_FONT_CACHE_BMP_SIZE * sizeof(__GLCfont*));
+    }
+
+    This->fontCache[inCode] = inFont;
+    This->fontCacheDirty = GL_TRUE;
+    return;
+  }
+
+  /* The other codes are stored in a hash table which is kept at most half
+   * full so that the probe sequences remain short.
+   */
+  if (2 * (This->fontCacheHashCount + 1) > This->fontCacheHashSize) {
+    if (!__glcContextGrowFontCache(This))
+      return;
+  }
+
+  entry = __glcContextLookupFontCache(This, inCode);
+  if (!entry->font)
+    This->fontCacheHashCount++;
+  entry->code = inCode;
+  entry->font = inFont;
+  This->fontCacheDirty = GL_TRUE;
+}
+
+
+
+/* Empty the font cache. This function must be called each time that
+ * GLC_CURRENT_FONT_LIST is modified (except when a font is appended at its
+ * end) or that the character map of a font is changed.
+ */
+void __glcContextInvalidateFontCache(__GLCcontext* This)
+{
+  if (!This->fontCacheDirty)
+    return;
+
+  if (This->fontCache)
+    memset(This->fontCache, 0, GLC_FONT_CACHE_BMP_SIZE * sizeof(__GLCfont*));
+
+  if (This->fontCacheHash)
+    memset(This->fontCacheHash, 0,
+	   This->fontCacheHashSize * sizeof(__GLCfontCacheEntry));
+
+  This->fontCacheHashCount = 0;
+  This->fontCacheDirty = GL_FALSE;
+}
+
+
+
+/* Get the bucket of the set of the unmapped codes where 'inCode' is stored.
+ * If the code is not in the set, the function returns the empty bucket
+ * (which contains -1) where it should be inserted.
+ */
+static GLint* __glcContextLookupUnmappedCode(__GLCcontext* This,
+					     const GLint inCode)
+{
+  const GLCuint mask = This->unmappedCodesSize - 1;
+  GLint* entry = NULL;
+
+  for (entry = This->unmappedCodes + (__glcContextHashCode(inCode) & mask);
+       (*entry >= 0) && (*entry != inCode);
+       entry = This->unmappedCodes + ((entry - This->unmappedCodes + 1) & mask));
+
+  return entry;
+}
+
+
+
+/* Record that no font of the catalogs maps 'inCode' so that the next lookups
+ * of that code do not need to search a font for GLC_AUTO_FONT. As for the
+ * font cache, the code is simply not recorded if memory can not be allocated.
+ */
+void __glcContextAddUnmappedCode(__GLCcontext* This, const GLint inCode)
+{
+  if (inCode < 0)
+    return;
+
+  if (2 * (This->unmappedCodesCount + 1) > This->unmappedCodesSize) {
+    GLint* oldSet = This->unmappedCodes;
+    const int oldSize = This->unmappedCodesSize;
+    const int size = oldSize ? oldSize << 1 : 64;
+    int i = 0;
+
+    This->unmappedCodes = (GLint*)__glcMalloc(size * sizeof(GLint));
+    if (!This->unmappedCodes) {
+      This->unmappedCodes = oldSet;
+      return;
+    }
+
+    memset(This->unmappedCodes, 0xff, size * sizeof(GLint));
+    This->unmappedCodesSize = size;
+
+    for (i = 0; i < oldSize; i++) {
+      if (oldSet[i] >= 0)
+	*__glcContextLookupUnmappedCode(This, oldSet[i]) = oldSet[i];
+    }
+
+    if (oldSet)
+      __glcFree(oldSet);
+  }
+
+  *__glcContextLookupUnmappedCode(This, inCode) = inCode;
+  This->unmappedCodesCount++;
+}
+
+
+
+/* Forget the fonts that have been sorted for GLC_AUTO_FONT and the codes that
+ * have been found to be unmapped. This function must be called each time that
+ * the catalogs of the context change.
+ */
+static void __glcContextInvalidateFallback(__GLCcontext* This)
+{
+  if (This->fallbackFontSet) {
+    FcFontSetDestroy(This->fallbackFontSet);
+    This->fallbackFontSet = NULL;
+  }
+
+  if (This->unmappedCodesCount) {
+    memset(This->unmappedCodes, 0xff, This->unmappedCodesSize * sizeof(GLint));
+    This->unmappedCodesCount = 0;
+  }
+}
+
+
+
+/* Do the actual job of __glcContextGetFont() when the code is not stored in
+ * the font cache.
+ */
+static __GLCfont* __glcContextResolveFont(__GLCcontext *This,
+					  const GLint inCode)
 {
   __GLCfont* font = NULL;
 
@@ -569,6 +858,11 @@ __GLCfont* __glcContextGetFont(__GLCcontext *This, const GLint inCode)
       return font;
     }
 
+    /* Do not query Fontconfig again for the codes that no font maps */
+    if (This->unmappedCodesCount
+	&& (*__glcContextLookupUnmappedCode(This, inCode) == inCode))
+      return NULL;
+
     master = __glcMasterMatchCode(This, inCode);
     if (!master)
       return NULL;
@@ -586,6 +880,39 @@ __GLCfont* __glcContextGetFont(__GLCcontext *This, const GLint inCode)
 
 
 
+/* Returns the ID of the first font in GLC_CURRENT_FONT_LIST that maps
+ * 'inCode'. If there is no such font and GLC_AUTO_FONT is enabled, the
+ * function attempts to append a new font from GLC_FONT_LIST (or from a master)
+ * to GLC_CURRENT_FONT_LIST. If the attempt fails the function returns zero.
+ * 'inCode' must be given in UCS-4 format.
+ * The fonts that have been found are stored in a cache so that the next
+ * lookups of the same code do not need to query the character maps of the
+ * fonts of GLC_CURRENT_FONT_LIST.
+ */
+__GLCfont* __glcContextGetFont(__GLCcontext *This, const GLint inCode)
+{
+  __GLCfont* font = NULL;
+
+  /* Look for the code in the font cache */
+  if ((inCode >= 0) && (inCode < GLC_FONT_CACHE_BMP_SIZE)) {
+    if (This->fontCache && This->fontCache[inCode])
+      return This->fontCache[inCode];
+  }
+  else if (This->fontCacheHashCount) {
+    font = __glcContextLookupFontCache(This, inCode)->font;
+    if (font)
+      return font;
+  }
+
+  font = __glcContextResolveFont(This, inCode);
+  if (font)
+    __glcContextCacheFont(This, inCode, font);
+
+  return font;
+}
+
+
+
 /* Sometimes information may need to be stored temporarily by a thread.
  * The so-called 'buffer' is created for that purpose. Notice that it is a
  * component of the GLC state struct hence its lifetime is the same as the
@@ -618,139 +945,926 @@ GLCchar* __glcContextQueryBuffer(__GLCcontext *This, const size_t inSize)
 
 
 
-/* Update the hash table that which is used to convert master IDs into
- * Fontconfig patterns.
+/* Get the bucket of the table 'inTable' where the ID of the master which hash
+ * value is 'inHashValue' is stored. If the master is not in the table, the
+ * function returns the empty bucket (which contains -1) where its ID should be
+ * inserted. The hash values of the masters are read from 'inHashTable'.
  */
-static GLboolean __glcContextUpdateHashTable(__GLCcontext *This)
+static GLint* __glcContextLookupMasterID(GLint* inTable, const GLint inSize,
+					 const __GLCarray* inHashTable,
+					 const GLCchar32 inHashValue)
 {
-  FcPattern* pattern = NULL;
-  FcObjectSet* objectSet = NULL;
-  FcFontSet *fontSet = NULL;
-  int i = 0;
-  __GLCarray *updatedHashTable = NULL;
-
-  /* Use Fontconfig to get the default font files */
-  pattern = FcPatternCreate();
-  if (!pattern) {
-    __glcRaiseError(GLC_RESOURCE_ERROR);
-    return GL_FALSE;
-  }
-  objectSet = FcObjectSetBuild(FC_FAMILY, FC_FOUNDRY, FC_OUTLINE, FC_SPACING,
-			       NULL);
-  if (!objectSet) {
-    __glcRaiseError(GLC_RESOURCE_ERROR);
-    FcPatternDestroy(pattern);
-    return GL_FALSE;
-  }
-  fontSet = FcFontList(This->config, pattern, objectSet);
-  FcPatternDestroy(pattern);
-  FcObjectSetDestroy(objectSet);
-  if (!fontSet) {
-    __glcRaiseError(GLC_RESOURCE_ERROR);
-    return GL_FALSE;
-  }
+  const GLCuint mask = inSize - 1;
+  const GLCchar32* hashTable = (const GLCchar32*)GLC_ARRAY_DATA(inHashTable);
+  GLint* entry = NULL;
 
-  updatedHashTable = __glcArrayDuplicate(This->masterHashTable);
-  if (!updatedHashTable) {
-    FcFontSetDestroy(fontSet);
-    return GL_FALSE;
-  }
-
-  /* Parse the font set looking for fonts that are not already registered in the
-   * hash table.
-   */
-  for (i = 0; i < fontSet->nfont; i++) {
-    GLCchar32 hashValue = 0;
-    int j = 0;
-    const int length = GLC_ARRAY_LENGTH(updatedHashTable);
-    GLCchar32* hashTable = (GLCchar32*)GLC_ARRAY_DATA(updatedHashTable);
-    FcBool outline = FcFalse;
-    FcChar8* family = NULL;
-    int fixed = 0;
-    FcChar8* foundry = NULL;
-#ifdef DEBUGMODE
-    FcResult result = FcResultMatch;
+  for (entry = inTable + (__glcContextHashCode((GLint)inHashValue) & mask);
+       (*entry >= 0) && (hashTable[*entry] != inHashValue);
+       entry = inTable + ((entry - inTable + 1) & mask));
 
-    result = FcPatternGetBool(fontSet->fonts[i], FC_OUTLINE, 0, &outline);
-    assert(result != FcResultTypeMismatch);
-#else
-    FcPatternGetBool(fontSet->fonts[i], FC_OUTLINE, 0, &outline);
-#endif
+  return entry;
+}
 
-    /* Check whether the glyphs are outlines */
-    if (!outline)
-      continue;
 
-#ifdef DEBUGMODE
-    result = FcPatternGetString(fontSet->fonts[i], FC_FAMILY, 0, &family);
-    assert(result != FcResultTypeMismatch);
-    result = FcPatternGetString(fontSet->fonts[i], FC_FOUNDRY, 0, &foundry);
-    assert(result != FcResultTypeMismatch);
-    result = FcPatternGetInteger(fontSet->fonts[i], FC_SPACING, 0, &fixed);
-    assert(result != FcResultTypeMismatch);
-#else
-    FcPatternGetString(fontSet->fonts[i], FC_FAMILY, 0, &family);
-    FcPatternGetString(fontSet->fonts[i], FC_FOUNDRY, 0, &foundry);
-    FcPatternGetInteger(fontSet->fonts[i], FC_SPACING, 0, &fixed);
-#endif
 
-    if (foundry)
-      pattern = FcPatternBuild(NULL, FC_FAMILY, FcTypeString, family,
-			       FC_FOUNDRY, FcTypeString, foundry, FC_SPACING,
-			       FcTypeInteger, fixed, NULL);
-    else
-      pattern = FcPatternBuild(NULL, FC_FAMILY, FcTypeString, family,
-			       FC_SPACING, FcTypeInteger, fixed, NULL);
+/* Return the ID of the master which hash value is 'inHashValue' or -1 if there
+ * is no such master.
+ */
+GLint __glcContextGetMasterID(const __GLCcontext* This,
+			      const GLCchar32 inHashValue)
+{
+  if (!This->masterIDTable)
+    return -1;
 
-    if (!pattern) {
-      __glcRaiseError(GLC_RESOURCE_ERROR);
-      FcFontSetDestroy(fontSet);
-      __glcArrayDestroy(updatedHashTable);
-      return GL_FALSE;
-    }
+  return *__glcContextLookupMasterID(This->masterIDTable,
+				     This->masterIDTableSize,
+				     This->masterHashTable, inHashValue);
+}
 
-    /* Check if the font is already registered in the hash table */
-    hashValue = FcPatternHash(pattern);
-    FcPatternDestroy(pattern);
-    for (j = 0; j < length; j++) {
-      if (hashTable[j] == hashValue)
-	break;
-    }
 
-    /* If the font is already registered then parse the next one */
-    if (j != length)
-      continue;
 
-    /* Register the font (i.e. append its hash value to the hash table) */
-    if (!__glcArrayAppend(updatedHashTable, &hashValue)) {
-      FcFontSetDestroy(fontSet);
-      __glcArrayDestroy(updatedHashTable);
-      return GL_FALSE;
+/* Release the Fontconfig configuration of the context. The configuration
+ * which is shared by the contexts is destroyed when it is no longer used.
+ */
+static void __glcContextReleaseConfig(__GLCcontext *This)
+{
+  __glcLock();
+  if (This->config == __glcCommonArea.sharedConfig) {
+    if (!--__glcCommonArea.sharedConfigRefCount) {
+      FcConfigDestroy(__glcCommonArea.sharedConfig);
+      __glcCommonArea.sharedConfig = NULL;
     }
   }
+  else
+    FcConfigDestroy(This->config);
+  __glcUnlock();
 
-  FcFontSetDestroy(fontSet);
-  __glcArrayDestroy(This->masterHashTable);
-  This->masterHashTable = updatedHashTable;
-
-  return GL_TRUE;
+  This->config = NULL;
 }
 
 
 
-/* Append a catalog to the context catalog list */
-void __glcContextAppendCatalog(__GLCcontext* This, const GLCchar* inCatalog)
+/* Give the context its own copy of the Fontconfig configuration before its
+ * catalogs are modified (copy on write). The shared configuration has no
+ * application font directories, so the copy is simply loaded again from the
+ * configuration files.
+ */
+static GLboolean __glcContextPrivatizeConfig(__GLCcontext *This)
 {
-#ifdef __WIN32__
-  GLCchar8* duplicated = (GLCchar8*)_strdup((const char*)inCatalog);
-#else
-  GLCchar8* duplicated = (GLCchar8*)strdup((const char*)inCatalog);
-#endif
+  FcConfig* config = NULL;
 
-  if (!duplicated) {
-    __glcRaiseError(GLC_RESOURCE_ERROR);
-    return;
-  }
+  if (This->config != __glcCommonArea.sharedConfig)
+    return GL_TRUE;
+
+  __glcLock();
+  config = FcInitLoadConfigAndFonts();
+  __glcUnlock();
+  if (!config) {
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    return GL_FALSE;
+  }
+
+  __glcContextReleaseConfig(This);
+  This->config = config;
+  return GL_TRUE;
+}
+
+
+
+/* Release the index of the masters and the cached charmap of a master */
+static void __glcContextDestroyMasterIndex(__GLCcontext *This)
+{
+  int i = 0;
+
+  if (This->masterIndex) {
+    for (i = 0; i < This->masterIndexLength; i++) {
+      if (This->masterIndex[i].pattern)
+	FcPatternDestroy(This->masterIndex[i].pattern);
+    }
+    __glcFree(This->masterIndex);
+    This->masterIndex = NULL;
+    This->masterIndexLength = 0;
+  }
+
+  if (This->masterFaces) {
+    __glcFree(This->masterFaces);
+    This->masterFaces = NULL;
+  }
+
+  if (This->masterFonts) {
+    __glcFree(This->masterFonts);
+    This->masterFonts = NULL;
+  }
+
+  if (This->masterFontSet) {
+    FcFontSetDestroy(This->masterFontSet);
+    This->masterFontSet = NULL;
+  }
+
+  /* The faces of the masters may change so their charmaps must be rebuilt */
+  if (This->masterCharMap) {
+    __glcCharMapDestroy(This->masterCharMap);
+    This->masterCharMap = NULL;
+  }
+}
+
+
+
+/* Build the pattern of the master of the font 'inFont' : it contains the
+ * family, the foundry and the spacing of the font. The hash value of this
+ * pattern identifies the master.
+ * This function may be called by the thread that loads the catalogs in the
+ * background so it does not raise any error: it is up to the caller to raise
+ * GLC_RESOURCE_ERROR if it returns NULL.
+ */
+static FcPattern* __glcContextGetMasterPattern(FcPattern* inFont)
+{
+  FcChar8* family = NULL;
+  int fixed = 0;
+  FcChar8* foundry = NULL;
+  FcPattern* pattern = NULL;
+#ifdef DEBUGMODE
+  FcResult result = FcResultMatch;
+
+  result = FcPatternGetString(inFont, FC_FAMILY, 0, &family);
+  assert(result != FcResultTypeMismatch);
+  result = FcPatternGetString(inFont, FC_FOUNDRY, 0, &foundry);
+  assert(result != FcResultTypeMismatch);
+  result = FcPatternGetInteger(inFont, FC_SPACING, 0, &fixed);
+  assert(result != FcResultTypeMismatch);
+#else
+  FcPatternGetString(inFont, FC_FAMILY, 0, &family);
+  FcPatternGetString(inFont, FC_FOUNDRY, 0, &foundry);
+  FcPatternGetInteger(inFont, FC_SPACING, 0, &fixed);
+#endif
+
+  if (foundry)
+    pattern = FcPatternBuild(NULL, FC_FAMILY, FcTypeString, family,
+			     FC_FOUNDRY, FcTypeString, foundry, FC_SPACING,
+			     FcTypeInteger, fixed, NULL);
+  else
+    pattern = FcPatternBuild(NULL, FC_FAMILY, FcTypeString, family,
+			     FC_SPACING, FcTypeInteger, fixed, NULL);
+
+  return pattern;
+}
+
+
+
+/* Build the index of the masters : for each master ID, it stores the pattern
+ * of the master, the list of its faces and the list of its fonts so that the
+ * queries about the masters and the creation of fonts do not need to scan all
+ * the fonts of the catalogs with Fontconfig.
+ * The font set 'inFontSet' is the one which has been used to update the
+ * master hash table and 'inMasterID' contains the master ID of each of its
+ * fonts (or -1 for the fonts that are not outlines). The index takes the
+ * ownership of the font set.
+ */
+static GLboolean __glcContextUpdateMasterIndex(__GLCcontext *This,
+					       FcFontSet* inFontSet,
+					       const GLint* inMasterID)
+{
+  const int length = GLC_ARRAY_LENGTH(This->masterHashTable);
+  int i = 0;
+  int j = 0;
+  int rank = 0;
+
+  __glcContextDestroyMasterIndex(This);
+  This->masterFontSet = inFontSet;
+
+  /* The array of the faces is allocated with one entry per font : that is
+   * the maximum number of faces that can be stored in it.
+   */
+  This->masterIndex = (__GLCmasterEntry*)__glcMalloc((length + 1)
+						    * sizeof(__GLCmasterEntry));
+  This->masterFaces = (GLint*)__glcMalloc((inFontSet->nfont + 1)
+					  * sizeof(GLint));
+  This->masterFonts = (GLint*)__glcMalloc((inFontSet->nfont + 1)
+					  * sizeof(GLint));
+  if ((!This->masterIndex) || (!This->masterFaces) || (!This->masterFonts)) {
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    __glcContextDestroyMasterIndex(This);
+    return GL_FALSE;
+  }
+  memset(This->masterIndex, 0, (length + 1) * sizeof(__GLCmasterEntry));
+  This->masterIndexLength = length;
+
+  /* Count the fonts of each master. The pattern of the first font of a master
+   * is kept as the pattern of the master.
+   */
+  for (i = 0; i < inFontSet->nfont; i++) {
+    j = inMasterID[i];
+    if (j < 0)
+      continue;
+
+    if (!This->masterIndex[j].pattern) {
+      This->masterIndex[j].pattern =
+	__glcContextGetMasterPattern(inFontSet->fonts[i]);
+      if (!This->masterIndex[j].pattern) {
+	__glcRaiseError(GLC_RESOURCE_ERROR);
+	__glcContextDestroyMasterIndex(This);
+	return GL_FALSE;
+      }
+    }
+
+    This->masterIndex[j].fontCount++;
+  }
+
+  /* Compute the rank of the first face of each master */
+  for (j = 0; j < length; j++) {
+    This->masterIndex[j].firstFace = rank;
+    rank += This->masterIndex[j].fontCount;
+    This->masterIndex[j].fontCount = 0;
+  }
+
+  /* Store the fonts and the faces of the masters in the order of the font set.
+   * The faces which have the same style than a previous face of the same
+   * master are skipped since they can not be distinguished by their names.
+   */
+  for (i = 0; i < inFontSet->nfont; i++) {
+    __GLCmasterEntry* entry = NULL;
+    GLint* faces = NULL;
+    FcChar8* style = NULL;
+    int k = 0;
+
+    j = inMasterID[i];
+    if (j < 0)
+      continue;
+
+    entry = &This->masterIndex[j];
+    This->masterFonts[entry->firstFace + entry->fontCount++] = i;
+    faces = This->masterFaces + entry->firstFace;
+    FcPatternGetString(inFontSet->fonts[i], FC_STYLE, 0, &style);
+
+    for (k = 0; k < entry->faceCount; k++) {
+      FcChar8* faceStyle = NULL;
+
+      FcPatternGetString(inFontSet->fonts[faces[k]], FC_STYLE, 0, &faceStyle);
+      if (style && faceStyle && !strcmp((const char*)style,
+					 (const char*)faceStyle))
+	break;
+    }
+
+    if (k == entry->faceCount)
+      faces[entry->faceCount++] = i;
+  }
+
+  return GL_TRUE;
+}
+
+
+
+/* List the fonts of the catalogs of the configuration 'inConfig' and compute
+ * the hash value of the master of each font (the fonts that are not outlines
+ * get a null hash value). This function does not access the context so that
+ * it can be called by the thread that loads the catalogs in the background:
+ * it does not raise any error and returns GL_FALSE if it fails.
+ */
+static GLboolean __glcContextListFonts(FcConfig* inConfig,
+				       FcFontSet** outFontSet,
+				       GLCchar32** outHashValues)
+{
+  FcPattern* pattern = NULL;
+  FcObjectSet* objectSet = NULL;
+  FcFontSet *fontSet = NULL;
+  GLCchar32* hashValues = NULL;
+  int i = 0;
+
+  /* Use Fontconfig to get the default font files */
+  pattern = FcPatternCreate();
+  if (!pattern)
+    return GL_FALSE;
+  objectSet = FcObjectSetBuild(FC_FAMILY, FC_FOUNDRY, FC_STYLE, FC_SPACING,
+			       FC_FILE, FC_INDEX, FC_OUTLINE, FC_CHARSET, NULL);
+  if (!objectSet) {
+    FcPatternDestroy(pattern);
+    return GL_FALSE;
+  }
+  fontSet = FcFontList(inConfig, pattern, objectSet);
+  FcPatternDestroy(pattern);
+  FcObjectSetDestroy(objectSet);
+  if (!fontSet)
+    return GL_FALSE;
+
+  hashValues = (GLCchar32*)__glcMalloc((fontSet->nfont + 1)
+				       * sizeof(GLCchar32));
+  if (!hashValues) {
+    FcFontSetDestroy(fontSet);
+    return GL_FALSE;
+  }
+
+  for (i = 0; i < fontSet->nfont; i++) {
+    FcBool outline = FcFalse;
+#ifdef DEBUGMODE
+    FcResult result = FcResultMatch;
+
+    result = FcPatternGetBool(fontSet->fonts[i], FC_OUTLINE, 0, &outline);
+    assert(result != FcResultTypeMismatch);
+#else
+    FcPatternGetBool(fontSet->fonts[i], FC_OUTLINE, 0, &outline);
+#endif
+
+    hashValues[i] = 0;
+
+    /* Check whether the glyphs are outlines */
+    if (!outline)
+      continue;
+
+    pattern = __glcContextGetMasterPattern(fontSet->fonts[i]);
+    if (!pattern) {
+      FcFontSetDestroy(fontSet);
+      __glcFree(hashValues);
+      return GL_FALSE;
+    }
+
+    hashValues[i] = FcPatternHash(pattern);
+    FcPatternDestroy(pattern);
+  }
+
+  *outFontSet = fontSet;
+  *outHashValues = hashValues;
+  return GL_TRUE;
+}
+
+
+
+/* Update the hash table that which is used to convert master IDs into
+ * Fontconfig patterns with the fonts of 'inFontSet' whose master hash values
+ * have been computed by __glcContextListFonts(). The masters that are not
+ * already registered are appended to the hash table so that the IDs of the
+ * existing masters do not change. The index of the masters is rebuilt from
+ * the same font set : it takes the ownership of the font set.
+ */
+static GLboolean __glcContextRegisterFonts(__GLCcontext *This,
+					   FcFontSet* inFontSet,
+					   const GLCchar32* inHashValues)
+{
+  int i = 0;
+  int length = 0;
+  __GLCarray *updatedHashTable = NULL;
+  GLint* idTable = NULL;
+  GLint idTableSize = 0;
+  GLint* masterID = NULL;
+  GLboolean success = GL_FALSE;
+
+  updatedHashTable = __glcArrayDuplicate(This->masterHashTable);
+  if (!updatedHashTable) {
+    FcFontSetDestroy(inFontSet);
+    return GL_FALSE;
+  }
+
+  /* The table that converts the hash values into master IDs is sized so that
+   * it remains at most half full even if every font of the font set is a new
+   * master.
+   */
+  length = GLC_ARRAY_LENGTH(updatedHashTable);
+  for (idTableSize = 64; idTableSize < 2 * (length + inFontSet->nfont + 1);
+       idTableSize <<= 1);
+  idTable = (GLint*)__glcMalloc(idTableSize * sizeof(GLint));
+  masterID = (GLint*)__glcMalloc((inFontSet->nfont + 1) * sizeof(GLint));
+  if ((!idTable) || (!masterID)) {
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    if (idTable)
+      __glcFree(idTable);
+    if (masterID)
+      __glcFree(masterID);
+    FcFontSetDestroy(inFontSet);
+    __glcArrayDestroy(updatedHashTable);
+    return GL_FALSE;
+  }
+  memset(idTable, 0xff, idTableSize * sizeof(GLint));
+
+  for (i = 0; i < length; i++) {
+    const GLCchar32 hashValue = ((GLCchar32*)GLC_ARRAY_DATA(updatedHashTable))[i];
+
+    *__glcContextLookupMasterID(idTable, idTableSize, updatedHashTable,
+				hashValue) = i;
+  }
+
+  /* Parse the font set looking for fonts that are not already registered in the
+   * hash table.
+   */
+  for (i = 0; i < inFontSet->nfont; i++) {
+    GLCchar32 hashValue = inHashValues[i];
+    GLint* entry = NULL;
+    FcBool outline = FcFalse;
+#ifdef DEBUGMODE
+    FcResult result = FcResultMatch;
+
+    result = FcPatternGetBool(inFontSet->fonts[i], FC_OUTLINE, 0, &outline);
+    assert(result != FcResultTypeMismatch);
+#else
+    FcPatternGetBool(inFontSet->fonts[i], FC_OUTLINE, 0, &outline);
+#endif
+
+    masterID[i] = -1;
+
+    /* Check whether the glyphs are outlines */
+    if (!outline)
+      continue;
+
+    /* Check if the font is already registered in the hash table */
+    entry = __glcContextLookupMasterID(idTable, idTableSize, updatedHashTable,
+				       hashValue);
+
+    /* Register the font (i.e. append its hash value to the hash table) */
+    if (*entry < 0) {
+      if (!__glcArrayAppend(updatedHashTable, &hashValue)) {
+	FcFontSetDestroy(inFontSet);
+	__glcArrayDestroy(updatedHashTable);
+	__glcFree(idTable);
+	__glcFree(masterID);
+	return GL_FALSE;
+      }
+      *entry = GLC_ARRAY_LENGTH(updatedHashTable) - 1;
+    }
+
+    masterID[i] = *entry;
+  }
+
+  __glcArrayDestroy(This->masterHashTable);
+  This->masterHashTable = updatedHashTable;
+  if (This->masterIDTable)
+    __glcFree(This->masterIDTable);
+  This->masterIDTable = idTable;
+  This->masterIDTableSize = idTableSize;
+
+  /* The fonts that are available for GLC_AUTO_FONT may have changed */
+  __glcContextInvalidateFallback(This);
+
+  success = __glcContextUpdateMasterIndex(This, inFontSet, masterID);
+  __glcFree(masterID);
+  return success;
+}
+
+
+
+/* Update the hash table and the index of the masters with the fonts of the
+ * catalogs of the configuration of the context.
+ */
+static GLboolean __glcContextUpdateHashTable(__GLCcontext *This)
+{
+  FcFontSet* fontSet = NULL;
+  GLCchar32* hashValues = NULL;
+  GLboolean success = GL_FALSE;
+
+  if (!__glcContextListFonts(This->config, &fontSet, &hashValues)) {
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    return GL_FALSE;
+  }
+
+  success = __glcContextRegisterFonts(This, fontSet, hashValues);
+  __glcFree(hashValues);
+  return success;
+}
+
+
+
+/* Destroy a list of catalogs and the paths that it contains */
+static void __glcContextDestroyCatalogList(__GLCarray* inList)
+{
+  int i = 0;
+
+  for (i = 0; i < GLC_ARRAY_LENGTH(inList); i++) {
+    GLCchar8* string = ((GLCchar8**)GLC_ARRAY_DATA(inList))[i];
+
+    assert(string);
+    free(string);
+  }
+  __glcArrayDestroy(inList);
+}
+
+
+
+/* Duplicate a list of catalogs and the paths that it contains */
+static __GLCarray* __glcContextDuplicateCatalogList(__GLCarray* inList)
+{
+  __GLCarray* list = __glcArrayDuplicate(inList);
+  int i = 0;
+
+  if (!list)
+    return NULL;
+
+  for (i = 0; i < GLC_ARRAY_LENGTH(list); i++) {
+    GLCchar8** string = ((GLCchar8**)GLC_ARRAY_DATA(list)) + i;
+
+#ifdef __WIN32__
+    *string = (GLCchar8*)_strdup((const char*)*string);
+#else
+    *string = (GLCchar8*)strdup((const char*)*string);
+#endif
+    if (!*string) {
+      __glcRaiseError(GLC_RESOURCE_ERROR);
+      GLC_ARRAY_LENGTH(list) = i;
+      __glcContextDestroyCatalogList(list);
+      return NULL;
+    }
+  }
+
+  return list;
+}
+
+
+
+/* Release the catalogs that are waiting to be loaded */
+static void __glcContextClearCatalogRequests(__GLCcontext *This)
+{
+  __GLCcatalogRequest* requests = NULL;
+  int i = 0;
+
+  if (!This->catalogRequests)
+    return;
+
+  requests = (__GLCcatalogRequest*)GLC_ARRAY_DATA(This->catalogRequests);
+  for (i = 0; i < GLC_ARRAY_LENGTH(This->catalogRequests); i++) {
+    if (requests[i].catalog)
+      free(requests[i].catalog);
+  }
+  GLC_ARRAY_LENGTH(This->catalogRequests) = 0;
+}
+
+
+
+/* Destructor of the catalog loader */
+static void __glcContextDestroyLoader(__GLCcatalogLoader *inLoader)
+{
+  if (inLoader->catalogList)
+    __glcContextDestroyCatalogList(inLoader->catalogList);
+  if (inLoader->config)
+    FcConfigDestroy(inLoader->config);
+  if (inLoader->fontSet)
+    FcFontSetDestroy(inLoader->fontSet);
+  if (inLoader->hashValues)
+    __glcFree(inLoader->hashValues);
+#ifndef __WIN32__
+  pthread_mutex_destroy(&inLoader->mutex);
+#else
+  DeleteCriticalSection(&inLoader->section);
+#endif
+  __glcFree(inLoader);
+}
+
+
+
+/* Add the catalogs of the loader to its Fontconfig configuration and list
+ * their fonts. This is the job of the thread that loads the catalogs in the
+ * background : it must neither access the context nor raise errors since the
+ * context may be used meanwhile by the thread that owns it. The catalogs that
+ * can not be loaded are counted in 'failedCount' so that the failures can be
+ * reported later by the thread that owns the context. It must not call
+ * __glcLock() either since the context may be destroyed while the common area
+ * is locked : the calls to Fontconfig are thus not serialized, which is why
+ * the loader thread is only started if Fontconfig is thread-safe (see
+ * __glcContextStartLoader()).
+ */
+static void __glcContextRunLoader(__GLCcatalogLoader *inLoader)
+{
+  FcConfig* config = inLoader->config;
+  FcFontSet* fontSet = NULL;
+  GLCchar32* hashValues = NULL;
+  int i = 0;
+
+  /* The catalogs that can not be added to the configuration are removed from
+   * the list.
+   */
+  while (i < GLC_ARRAY_LENGTH(inLoader->catalogList)) {
+    GLCchar8* catalog = ((GLCchar8**)GLC_ARRAY_DATA(inLoader->catalogList))[i];
+
+    if (!FcConfigAppFontAddDir(config, catalog)) {
+      __glcArrayRemove(inLoader->catalogList, i);
+      free(catalog);
+      inLoader->failedCount++;
+    }
+    else
+      i++;
+  }
+
+  /* If the fonts can not be listed, none of the catalogs is published */
+  if (!__glcContextListFonts(config, &fontSet, &hashValues))
+    inLoader->failedCount = inLoader->catalogCount;
+
+#ifndef __WIN32__
+  pthread_mutex_lock(&inLoader->mutex);
+#else
+  EnterCriticalSection(&inLoader->section);
+#endif
+  inLoader->fontSet = fontSet;
+  inLoader->hashValues = hashValues;
+  inLoader->done = GL_TRUE;
+#ifndef __WIN32__
+  pthread_mutex_unlock(&inLoader->mutex);
+#else
+  LeaveCriticalSection(&inLoader->section);
+#endif
+}
+
+
+
+#ifdef HAVE_THREADSAFE_FONTCONFIG
+#ifndef __WIN32__
+static void* __glcContextLoaderThread(void* inLoader)
+{
+  __glcContextRunLoader((__GLCcatalogLoader*)inLoader);
+  return NULL;
+}
+#else
+static DWORD WINAPI __glcContextLoaderThread(LPVOID inLoader)
+{
+  __glcContextRunLoader((__GLCcatalogLoader*)inLoader);
+  return 0;
+}
+#endif
+#endif /* HAVE_THREADSAFE_FONTCONFIG */
+
+
+
+/* Wait for the thread of the loader to finish its job */
+static void __glcContextJoinLoader(__GLCcatalogLoader *inLoader)
+{
+#ifndef __WIN32__
+  pthread_join(inLoader->thread, NULL);
+#else
+  WaitForSingleObject(inLoader->thread, INFINITE);
+  CloseHandle(inLoader->thread);
+#endif
+}
+
+
+
+/* Replace the configuration and the catalog list of the context by the ones
+ * that the loader has built then destroy the loader. The masters of the new
+ * catalogs are appended to the hash table so that the IDs of the masters that
+ * were already known do not change. The catalogs that the loader has rejected
+ * are only counted : the error is raised by
+ * __glcContextGetPendingCatalogCount() so that it is not reported by whichever
+ * command happens to publish the catalogs.
+ */
+static void __glcContextCommitLoader(__GLCcontext *This,
+				     __GLCcatalogLoader *inLoader)
+{
+  This->failedCatalogCount += inLoader->failedCount;
+
+  if (inLoader->fontSet) {
+    __glcContextReleaseConfig(This);
+    This->config = inLoader->config;
+    inLoader->config = NULL;
+
+    __glcContextDestroyCatalogList(This->catalogList);
+    This->catalogList = inLoader->catalogList;
+    inLoader->catalogList = NULL;
+
+    __glcContextRegisterFonts(This, inLoader->fontSet, inLoader->hashValues);
+    inLoader->fontSet = NULL;
+  }
+
+  __glcContextDestroyLoader(inLoader);
+}
+
+
+
+/* Start a thread that loads the catalogs of the context together with the
+ * catalogs that have been requested since the last update of the context.
+ */
+static void __glcContextStartLoader(__GLCcontext *This)
+{
+  __GLCcatalogLoader* loader = NULL;
+  __GLCcatalogRequest* requests = NULL;
+  int i = 0;
+
+  assert(!This->catalogLoader);
+  assert(This->catalogRequests);
+
+  loader = (__GLCcatalogLoader*)__glcMalloc(sizeof(__GLCcatalogLoader));
+  if (!loader) {
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    __glcContextClearCatalogRequests(This);
+    return;
+  }
+  memset(loader, 0, sizeof(__GLCcatalogLoader));
+#ifndef __WIN32__
+  if (pthread_mutex_init(&loader->mutex, NULL)) {
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    __glcFree(loader);
+    __glcContextClearCatalogRequests(This);
+    return;
+  }
+#else
+  InitializeCriticalSection(&loader->section);
+#endif
+
+  loader->catalogList = __glcContextDuplicateCatalogList(This->catalogList);
+  if (!loader->catalogList) {
+    __glcContextDestroyLoader(loader);
+    __glcContextClearCatalogRequests(This);
+    return;
+  }
+
+  /* The configuration files are read by the calling thread since the loader
+   * thread must not lock the common area. The slow part is the scan of the
+   * catalogs which is left to the loader thread.
+   */
+  __glcLock();
+  loader->config = FcInitLoadConfigAndFonts();
+  __glcUnlock();
+  if (!loader->config) {
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    __glcContextDestroyLoader(loader);
+    __glcContextClearCatalogRequests(This);
+    return;
+  }
+
+  requests = (__GLCcatalogRequest*)GLC_ARRAY_DATA(This->catalogRequests);
+  for (i = 0; i < GLC_ARRAY_LENGTH(This->catalogRequests); i++) {
+    __GLCarray* list = NULL;
+
+    if (requests[i].append)
+      list = __glcArrayAppend(loader->catalogList, &requests[i].catalog);
+    else
+      list = __glcArrayInsert(loader->catalogList, 0, &requests[i].catalog);
+
+    if (!list) {
+      __glcContextDestroyLoader(loader);
+      __glcContextClearCatalogRequests(This);
+      return;
+    }
+
+    /* The path is now owned by the loader */
+    requests[i].catalog = NULL;
+  }
+  loader->catalogCount = GLC_ARRAY_LENGTH(This->catalogRequests);
+  __glcContextClearCatalogRequests(This);
+
+#ifdef HAVE_THREADSAFE_FONTCONFIG
+#ifndef __WIN32__
+  if (!pthread_create(&loader->thread, NULL, __glcContextLoaderThread,
+		      loader)) {
+#else
+  loader->thread = CreateThread(NULL, 0, __glcContextLoaderThread, loader, 0,
+				NULL);
+  if (loader->thread) {
+#endif
+    This->catalogLoader = loader;
+    return;
+  }
+#endif
+
+  /* The catalogs are loaded synchronously if Fontconfig is not thread-safe or
+   * if no thread can be created.
+   */
+  __glcContextRunLoader(loader);
+  __glcContextCommitLoader(This, loader);
+}
+
+
+
+/* Publish the catalogs that the loader has loaded then start loading the
+ * catalogs that have been requested meanwhile.
+ */
+static void __glcContextCompleteLoader(__GLCcontext *This)
+{
+  __GLCcatalogLoader* loader = This->catalogLoader;
+
+  __glcContextJoinLoader(loader);
+  This->catalogLoader = NULL;
+  __glcContextCommitLoader(This, loader);
+
+  if (GLC_ARRAY_LENGTH(This->catalogRequests))
+    __glcContextStartLoader(This);
+}
+
+
+
+/* This function is called by the GLC commands that use the catalogs : if the
+ * catalogs that are loaded in the background are ready, they are published in
+ * the context. It never waits for the loader thread.
+ */
+void __glcContextPublishCatalogs(__GLCcontext* This)
+{
+  GLboolean done = GL_FALSE;
+
+  if (!This->catalogLoader)
+    return;
+
+#ifndef __WIN32__
+  pthread_mutex_lock(&This->catalogLoader->mutex);
+  done = This->catalogLoader->done;
+  pthread_mutex_unlock(&This->catalogLoader->mutex);
+#else
+  EnterCriticalSection(&This->catalogLoader->section);
+  done = This->catalogLoader->done;
+  LeaveCriticalSection(&This->catalogLoader->section);
+#endif
+
+  if (done)
+    __glcContextCompleteLoader(This);
+}
+
+
+
+/* Wait until all the catalogs that are loaded in the background have been
+ * published. The commands that modify the catalogs synchronously must call it
+ * first so that the catalogs are added in the order of the requests.
+ */
+static void __glcContextFinishCatalogs(__GLCcontext* This)
+{
+  while (This->catalogLoader)
+    __glcContextCompleteLoader(This);
+}
+
+
+
+/* Request a catalog to be appended or prepended to the catalog list by the
+ * loader thread (GLC_ASYNC_CATALOG_QSO).
+ */
+static void __glcContextQueueCatalog(__GLCcontext* This,
+				     const GLCchar* inCatalog,
+				     const GLboolean inAppend)
+{
+  __GLCcatalogRequest request;
+
+  __glcContextPublishCatalogs(This);
+
+  if (!This->catalogRequests) {
+    This->catalogRequests = __glcArrayCreate(sizeof(__GLCcatalogRequest));
+    if (!This->catalogRequests)
+      return;
+  }
+
+#ifdef __WIN32__
+  request.catalog = (GLCchar8*)_strdup((const char*)inCatalog);
+#else
+  request.catalog = (GLCchar8*)strdup((const char*)inCatalog);
+#endif
+  request.append = inAppend;
+
+  if (!request.catalog) {
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    return;
+  }
+
+  if (!__glcArrayAppend(This->catalogRequests, &request)) {
+    free(request.catalog);
+    return;
+  }
+
+  if (!This->catalogLoader)
+    __glcContextStartLoader(This);
+}
+
+
+
+/* Return the number of catalogs that have been requested but are not yet in
+ * GLC_CATALOG_LIST. This is where the failures of the loader are reported :
+ * if catalogs have been rejected since the last call, GLC_RESOURCE_ERROR is
+ * raised.
+ */
+GLint __glcContextGetPendingCatalogCount(__GLCcontext* This)
+{
+  GLint count = 0;
+
+  if (This->failedCatalogCount) {
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    This->failedCatalogCount = 0;
+  }
+
+  if (This->catalogRequests)
+    count = GLC_ARRAY_LENGTH(This->catalogRequests);
+  if (This->catalogLoader)
+    count += This->catalogLoader->catalogCount;
+
+  return count;
+}
+
+
+
+/* Append a catalog to the context catalog list */
+void __glcContextAppendCatalog(__GLCcontext* This, const GLCchar* inCatalog)
+{
+  GLCchar8* duplicated = NULL;
+
+  if (This->enableState.asyncCatalog) {
+    __glcContextQueueCatalog(This, inCatalog, GL_TRUE);
+    return;
+  }
+
+  /* The catalogs that are loaded in the background must be added first */
+  __glcContextFinishCatalogs(This);
+
+#ifdef __WIN32__
+  duplicated = (GLCchar8*)_strdup((const char*)inCatalog);
+#else
+  duplicated = (GLCchar8*)strdup((const char*)inCatalog);
+#endif
+
+  if (!duplicated) {
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    return;
+  }
+
+  if (!__glcContextPrivatizeConfig(This)) {
+    free(duplicated);
+    return;
+  }
 
   if (!__glcArrayAppend(This->catalogList, &duplicated)) {
     free(duplicated);
@@ -778,10 +1892,20 @@ void __glcContextAppendCatalog(__GLCcontext* This, const GLCchar* inCatalog)
 /* Prepend a catalog to the context catalog list */
 void __glcContextPrependCatalog(__GLCcontext* This, const GLCchar* inCatalog)
 {
+  GLCchar8* duplicated = NULL;
+
+  if (This->enableState.asyncCatalog) {
+    __glcContextQueueCatalog(This, inCatalog, GL_FALSE);
+    return;
+  }
+
+  /* The catalogs that are loaded in the background must be added first */
+  __glcContextFinishCatalogs(This);
+
 #ifdef __WIN32__
-  GLCchar8* duplicated = (GLCchar8*)_strdup((const char*)inCatalog);
+  duplicated = (GLCchar8*)_strdup((const char*)inCatalog);
 #else
-  GLCchar8* duplicated = (GLCchar8*)strdup((const char*)inCatalog);
+  duplicated = (GLCchar8*)strdup((const char*)inCatalog);
 #endif
 
   if (!duplicated) {
@@ -789,6 +1913,11 @@ void __glcContextPrependCatalog(__GLCcontext* This, const GLCchar* inCatalog)
     return;
   }
 
+  if (!__glcContextPrivatizeConfig(This)) {
+    free(duplicated);
+    return;
+  }
+
   if (!__glcArrayInsert(This->catalogList, 0, &duplicated)) {
     free(duplicated);
     return;
@@ -840,6 +1969,7 @@ void __glcContextDeleteFont(__GLCcontext* inContext, __GLCfont* font)
   /* If the font has been found, remove it from the list */
   if (node) {
     FT_List_Remove(&inContext->currentFontList, node);
+    __glcContextInvalidateFontCache(inContext);
 #ifndef GLC_FT_CACHE
     __glcFontClose(font);
 #endif
@@ -857,11 +1987,15 @@ void __glcContextRemoveCatalog(__GLCcontext* This, const GLint inIndex)
   GLCchar8* catalog = NULL;
   int i = 0;
 
+  __glcContextFinishCatalogs(This);
+
   if (inIndex >= GLC_ARRAY_LENGTH(This->catalogList)) {
     __glcRaiseError(GLC_PARAMETER_ERROR);
     return;
   }
 
+  /* A context which has catalogs always owns its configuration */
+  assert(This->config != __glcCommonArea.sharedConfig);
   FcConfigAppFontClear(This->config);
   catalog = ((GLCchar8**)GLC_ARRAY_DATA(This->catalogList))[inIndex];
   assert(catalog);
@@ -881,8 +2015,13 @@ void __glcContextRemoveCatalog(__GLCcontext* This, const GLint inIndex)
     }
   }
 
-  /* Re-create the hash table from scratch */
+  /* Re-create the hash table and the index of the masters from scratch */
   GLC_ARRAY_LENGTH(This->masterHashTable) = 0;
+  __glcContextDestroyMasterIndex(This);
+  if (This->masterIDTable) {
+    __glcFree(This->masterIDTable);
+    This->masterIDTable = NULL;
+  }
   __glcContextUpdateHashTable(This);
 
   /* Remove from GLC_FONT_LIST the fonts that were defined in the catalog that
@@ -891,23 +2030,13 @@ void __glcContextRemoveCatalog(__GLCcontext* This, const GLint inIndex)
    */
   for (node = This->fontList.head; node; node = node->next) {
     __GLCfont* font = (__GLCfont*)(node->data);
-    GLCchar32 hashValue = 0;
-    GLCchar32* hashTable = (GLCchar32*)GLC_ARRAY_DATA(This->masterHashTable);
-    const int length = GLC_ARRAY_LENGTH(This->masterHashTable);
     __GLCmaster* master = __glcMasterCreate(font->parentMasterID, This);
 
     if (!master)
       continue;
 
-    /* Check if the hash value of the master is in the hash table */
-    hashValue = GLC_MASTER_HASH_VALUE(master);
-    for (i = 0; i < length; i++) {
-      if (hashValue == hashTable[i])
-	break;
-    }
-
     /* The font is not contained in the hash table => remove it */
-    if (i == length) {
+    if (__glcContextGetMasterID(This, GLC_MASTER_HASH_VALUE(master)) < 0) {
       FT_List_Remove(&This->fontList, node);
       __glcContextDeleteFont(This, font);
     }
@@ -31,7 +31,6 @@
 #include <windows.h>
 #endif
 
-#include <sqlite3.h>
 #include <ft2build.h>
 #include FT_FREETYPE_H
 #ifdef GLC_FT_CACHE
@@ -44,9 +43,12 @@
 
 #define GLC_MAX_MATRIX_STACK_DEPTH	32
 #define GLC_MAX_ATTRIB_STACK_DEPTH	16
+#define GLC_FONT_CACHE_BMP_SIZE		0x10000
+#define GLC_CHAR_NAME_LEN		128
 
 typedef struct __GLCcontextRec __GLCcontext;
 typedef struct __GLCtextureRec __GLCtexture;
+typedef struct __GLCatlasPageRec __GLCatlasPage;
 typedef struct __GLCenableStateRec __GLCenableState;
 typedef struct __GLCrenderStateRec __GLCrenderState;
 typedef struct __GLCstringStateRec __GLCstringState;
@@ -55,6 +57,10 @@ typedef struct __GLCattribStackLevelRec  __GLCattribStackLevel;
 typedef struct __GLCthreadAreaRec __GLCthreadArea;
 typedef struct __GLCcommonAreaRec  __GLCcommonArea;
 typedef struct __GLCfontRec __GLCfont;
+typedef struct __GLCfontCacheEntryRec __GLCfontCacheEntry;
+typedef struct __GLCmasterEntryRec __GLCmasterEntry;
+typedef struct __GLCcatalogLoaderRec __GLCcatalogLoader;
+typedef struct __GLCcatalogRequestRec __GLCcatalogRequest;
 
 struct __GLCtextureRec {
   GLuint id;
@@ -63,6 +69,41 @@ struct __GLCtextureRec {
   GLuint bufferObjectID;
 };
 
+struct __GLCfontCacheEntryRec {
+  GLint code;
+  __GLCfont* font;
+};
+
+struct __GLCmasterEntryRec {
+  FcPattern* pattern;		/* Family, foundry and spacing of the master */
+  GLint firstFace;		/* Rank of the first face in masterFaces and of
+				   the first font in masterFonts */
+  GLint faceCount;		/* Number of faces of the master */
+  GLint fontCount;		/* Number of fonts of the master */
+};
+
+struct __GLCcatalogLoaderRec {
+  __GLCarray* catalogList;	/* Catalogs of the configuration to load */
+  GLint catalogCount;		/* Number of catalogs that are added */
+  FcConfig* config;		/* Configuration that has been loaded */
+  FcFontSet* fontSet;		/* Fonts of the catalogs */
+  GLCchar32* hashValues;	/* Hash values of the masters of the fonts */
+  GLint failedCount;		/* Number of catalogs that are rejected */
+  GLboolean done;		/* Has the thread finished its job ? */
+#ifndef __WIN32__
+  pthread_t thread;
+  pthread_mutex_t mutex;	/* Protects 'done' and the results */
+#else
+  HANDLE thread;
+  CRITICAL_SECTION section;
+#endif
+};
+
+struct __GLCcatalogRequestRec {
+  GLCchar8* catalog;
+  GLboolean append;		/* Append or prepend the catalog ? */
+};
+
 struct __GLCenableStateRec {
   GLboolean autoFont;		/* GLC_AUTO_FONT */
   GLboolean glObjects;		/* GLC_GLOBJECTS */
@@ -70,12 +111,15 @@ struct __GLCenableStateRec {
   GLboolean hinting;		/* GLC_HINTING_QSO */
   GLboolean extrude;		/* GLC_EXTRUDE_QSO */
   GLboolean kerning;		/* GLC_KERNING_QSO */
+  GLboolean preloadMetrics;	/* GLC_PRELOAD_METRICS_QSO */
+  GLboolean asyncCatalog;	/* GLC_ASYNC_CATALOG_QSO */
 };
 
 struct __GLCrenderStateRec {
   GLfloat resolution;		/* GLC_RESOLUTION */
   GLint renderStyle;		/* GLC_RENDER_STYLE */
   GLfloat tolerance;		/* GLC_PARAMETRIC_TOLERANCE_QSO */
+  GLint atlasPageBudget;	/* GLC_ATLAS_PAGE_BUDGET_QSO */
 };
 
 struct __GLCstringStateRec {
@@ -147,8 +191,29 @@ struct __GLCcontextRec {
   FT_ListRec currentFontList;	/* GLC_CURRENT_FONT_LIST */
   FT_ListRec fontList;		/* GLC_FONT_LIST */
   FT_ListRec genFontList;       /* Fonts generated by glcGenFontID() */
+  __GLCfont** fontCache;	/* Fonts of the current list for the BMP */
+  __GLCfontCacheEntry* fontCacheHash; /* Fonts for the other planes */
+  GLint fontCacheHashSize;
+  GLint fontCacheHashCount;
+  GLboolean fontCacheDirty;	/* Do the font caches hold entries ? */
+  FcFontSet* fallbackFontSet;	/* Sorted fonts for GLC_AUTO_FONT */
+  GLint* unmappedCodes;		/* Codes that no font of the catalogs maps */
+  GLint unmappedCodesSize;
+  GLint unmappedCodesCount;
   __GLCarray* masterHashTable;
+  GLint* masterIDTable;		/* Master IDs sorted by hash values */
+  GLint masterIDTableSize;
+  FcFontSet* masterFontSet;	/* Faces of the fonts of the catalogs */
+  __GLCmasterEntry* masterIndex; /* Masters sorted by ID */
+  GLint masterIndexLength;
+  GLint* masterFaces;		/* Ranks in masterFontSet of the faces */
+  GLint* masterFonts;		/* Ranks in masterFontSet of the fonts */
+  struct __GLCcharMapRec* masterCharMap; /* Last enumerated master charmap */
+  GLint masterCharMapID;	/* ID of the master of masterCharMap */
   __GLCarray* catalogList;	/* GLC_CATALOG_LIST */
+  __GLCcatalogLoader* catalogLoader; /* Catalogs loaded in the background */
+  __GLCarray* catalogRequests;	/* Catalogs waiting for the loader */
+  GLint failedCatalogCount;	/* Catalogs rejected by the loader */
   __GLCarray* measurementBuffer;
   GLfloat measurementStringBuffer[12];
   __GLCarray* vertexArray;	/* Array of vertices */
@@ -161,12 +226,19 @@ struct __GLCcontextRec {
   GLEWContext glewContext;	/* GLEW context for OpenGL extensions */
 #endif
   __GLCtexture texture;		/* Texture for immediate mode rendering */
+  __GLCatlasPage* textureCache;	/* Glyphs cached for immediate mode */
+  FT_ListRec textureCacheList;	/* LRU list of the glyphs of textureCache */
 
-  __GLCtexture atlas;
+  __GLCtexture atlas;		/* Size of the pages and VBO of the atlas */
   FT_ListRec atlasList;
-  int atlasWidth;
-  int atlasHeight;
-  int atlasCount;
+  __GLCarray* atlasPages;	/* Textures of the atlas */
+  __GLCarray* atlasVertices;	/* Copy of the VBO content of the atlas */
+  __GLCarray* atlasFreeQuads;	/* Unused quads of atlasVertices */
+  GLint atlasBufferSize;	/* Number of quads stored in the VBO */
+  GLboolean atlasSubData;	/* Can glBufferSubData() update the VBO ? */
+
+  FT_ListRec bitmapList;	/* Images of GLC_BITMAP and GLC_PIXMAP_QSO */
+  GLint bitmapCacheSize;	/* Number of bytes used by bitmapList */
 
   GLfloat* bitmapMatrix;	/* GLC_BITMAP_MATRIX */
   GLfloat bitmapMatrixStack[4*GLC_MAX_MATRIX_STACK_DEPTH];
@@ -185,6 +257,7 @@ struct __GLCthreadAreaRec {
   GLint lockState;
   FT_ListRec exceptionStack;
   __glcException failedTry;
+  GLCchar8 charName[GLC_CHAR_NAME_LEN]; /* Last Unicode name looked up */
 };
 
 struct __GLCcommonAreaRec {
@@ -213,7 +286,11 @@ struct __GLCcommonAreaRec {
    * However, this has not happened yet so we still rely on FT_MemoryRec_ ...
    */
   struct FT_MemoryRec_ memoryManager;
-  sqlite3 *db;
+
+  FcConfig* sharedConfig;	/* Configuration shared by the contexts */
+  GLint sharedConfigRefCount;
+
+  FT_ListRec fontFileList;	/* Font files mapped in memory */
 };
 
 extern __GLCcommonArea __glcCommonArea;
@@ -231,7 +308,13 @@ GLCchar* __glcContextQueryBuffer(__GLCcontext *This, const size_t inSize);
 void __glcContextAppendCatalog(__GLCcontext* This, const GLCchar* inCatalog);
 void __glcContextPrependCatalog(__GLCcontext* This, const GLCchar* inCatalog);
 void __glcContextRemoveCatalog(__GLCcontext* This, const GLint inIndex);
+void __glcContextPublishCatalogs(__GLCcontext* This);
+GLint __glcContextGetPendingCatalogCount(__GLCcontext* This);
 GLCchar8* __glcContextGetCatalogPath(const __GLCcontext* This,
 				     const GLint inIndex);
 void __glcContextDeleteFont(__GLCcontext* inContext, __GLCfont* font);
+void __glcContextInvalidateFontCache(__GLCcontext* This);
+void __glcContextAddUnmappedCode(__GLCcontext* This, const GLint inCode);
+GLint __glcContextGetMasterID(const __GLCcontext* This,
+			      const GLCchar32 inHashValue);
 #endif /* __glc_ocontext_h */
@@ -28,6 +28,12 @@
 
 #include <fontconfig/fontconfig.h>
 #include <fontconfig/fcfreetype.h>
+#ifndef __WIN32__
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 #include "internal.h"
 #include "texture.h"
@@ -36,6 +42,9 @@
 #include FT_CACHE_H
 #endif
 #include FT_OUTLINE_H
+#ifdef FT_ADVANCES_H
+#include FT_ADVANCES_H
+#endif
 
 #include FT_TYPE1_TABLES_H
 #ifdef FT_XFREE86_H
@@ -61,123 +70,20 @@ __GLCfaceDescriptor* __glcFaceDescCreate(const __GLCmaster* inMaster,
 					 const GLint inCode)
 {
   __GLCfaceDescriptor* This = NULL;
-  FcObjectSet* objectSet = NULL;
-  FcFontSet *fontSet = NULL;
-  int i = 0;
-  FcPattern* pattern = FcPatternCreate();
-
-  if (!pattern) {
-    __glcRaiseError(GLC_RESOURCE_ERROR);
-    return NULL;
-  }
-
-  objectSet = FcObjectSetBuild(FC_FAMILY, FC_FOUNDRY, FC_STYLE, FC_SPACING,
-			       FC_FILE, FC_INDEX, FC_OUTLINE, FC_CHARSET, NULL);
-  if (!objectSet) {
-    __glcRaiseError(GLC_RESOURCE_ERROR);
-    FcPatternDestroy(pattern);
-    return NULL;
-  }
-  fontSet = FcFontList(inContext->config, pattern, objectSet);
-  FcObjectSetDestroy(objectSet);
-  FcPatternDestroy(pattern);
-  if (!fontSet) {
-    __glcRaiseError(GLC_RESOURCE_ERROR);
-    return NULL;
-  }
-
-  for (i = 0; i < fontSet->nfont; i++) {
-    FcChar8* family = NULL;
-    int fixed = 0;
-    FcChar8* foundry = NULL;
-    FcChar8* style = NULL;
-    FcBool outline = FcFalse;
-    FcCharSet* charSet = NULL;
-    FcBool equal = FcFalse;
-#ifdef DEBUGMODE
-    FcResult result = FcResultMatch;
-
-    result = FcPatternGetBool(fontSet->fonts[i], FC_OUTLINE, 0, &outline);
-    assert(result != FcResultTypeMismatch);
-#else
-    FcPatternGetBool(fontSet->fonts[i], FC_OUTLINE, 0, &outline);
-#endif
-
-    /* Check whether the glyphs are outlines */
-    if (!outline)
-      continue;
-
-#ifdef DEBUGMODE
-    result = FcPatternGetCharSet(fontSet->fonts[i], FC_CHARSET, 0, &charSet);
-    assert(result != FcResultTypeMismatch);
-#else
-    FcPatternGetCharSet(fontSet->fonts[i], FC_CHARSET, 0, &charSet);
-#endif
-
-    /* Check that the code is included in the font */
-    if (inCode && !FcCharSetHasChar(charSet, inCode))
-      continue;
-
-#ifdef DEBUGMODE
-    result = FcPatternGetString(fontSet->fonts[i], FC_FAMILY, 0, &family);
-    assert(result != FcResultTypeMismatch);
-    result = FcPatternGetString(fontSet->fonts[i], FC_FOUNDRY, 0, &foundry);
-    assert(result != FcResultTypeMismatch);
-    result = FcPatternGetInteger(fontSet->fonts[i], FC_SPACING, 0, &fixed);
-    assert(result != FcResultTypeMismatch);
-#else
-    FcPatternGetString(fontSet->fonts[i], FC_FAMILY, 0, &family);
-    FcPatternGetString(fontSet->fonts[i], FC_FOUNDRY, 0, &foundry);
-    FcPatternGetInteger(fontSet->fonts[i], FC_SPACING, 0, &fixed);
-#endif
-
-    if (foundry)
-      pattern = FcPatternBuild(NULL, FC_FAMILY, FcTypeString, family,
-			       FC_FOUNDRY, FcTypeString, foundry, FC_SPACING,
-			       FcTypeInteger, fixed, NULL);
-    else
-      pattern = FcPatternBuild(NULL, FC_FAMILY, FcTypeString, family,
-			       FC_SPACING, FcTypeInteger, fixed, NULL);
-
-    if (!pattern) {
-      __glcRaiseError(GLC_RESOURCE_ERROR);
-      FcFontSetDestroy(fontSet);
-      return NULL;
-    }
+  FcPattern* pattern = __glcMasterGetFontPattern(inMaster, inContext, inFace,
+						 inCode);
 
-    equal = FcPatternEqual(pattern, inMaster->pattern);
-    FcPatternDestroy(pattern);
-    if (equal) {
-      if (inFace) {
-#ifdef DEBUGMODE
-	result = FcPatternGetString(fontSet->fonts[i], FC_STYLE, 0, &style);
-	assert(result != FcResultTypeMismatch);
-#else
-	FcPatternGetString(fontSet->fonts[i], FC_STYLE, 0, &style);
-#endif
-	if (strcmp((const char*)style, (const char*)inFace))
-	  continue;
-      }
-      break;
-    }
-  }
-
-  if (i == fontSet->nfont) {
-    FcFontSetDestroy(fontSet);
-    __glcRaiseError(GLC_RESOURCE_ERROR);
+  if (!pattern)
     return NULL;
-  }
 
   This = (__GLCfaceDescriptor*)__glcMalloc(sizeof(__GLCfaceDescriptor));
   if (!This) {
-    FcFontSetDestroy(fontSet);
     __glcRaiseError(GLC_RESOURCE_ERROR);
     return NULL;
   }
   memset(This, 0, sizeof(__GLCfaceDescriptor));
 
-  This->pattern = FcPatternDuplicate(fontSet->fonts[i]);
-  FcFontSetDestroy(fontSet);
+  This->pattern = FcPatternDuplicate(pattern);
   if (!This->pattern) {
     __glcRaiseError(GLC_RESOURCE_ERROR);
     __glcFree(This);
@@ -209,6 +115,18 @@ void __glcFaceDescDestroy(__GLCfaceDescriptor* This, __GLCcontext* inContext)
     node = next;
   }
 
+  if (This->glyphTable)
+    __glcFree(This->glyphTable);
+  if (This->kerningTable)
+    __glcFree(This->kerningTable);
+  if (This->kerningHash)
+    __glcFree(This->kerningHash);
+  if (This->metricsBlocks) {
+    __glcFree(This->metricsBlocks);
+    __glcFree(This->advances);
+    __glcFree(This->boundingBoxes);
+  }
+
 #if defined(GLC_FT_CACHE) \
   && (FREETYPE_MAJOR > 2 \
      || (FREETYPE_MAJOR == 2 \
@@ -224,6 +142,190 @@ void __glcFaceDescDestroy(__GLCfaceDescriptor* This, __GLCcontext* inContext)
 
 
 
+/* Release a reference to a font file and unmap it if no face uses it any
+ * longer.
+ */
+static void __glcFileUnmap(__GLCfontFile* inFile)
+{
+  __glcLock();
+  assert(inFile->refCount > 0);
+  if (!--inFile->refCount) {
+    FT_List_Remove(&__glcCommonArea.fontFileList, (FT_ListNode)inFile);
+#ifndef __WIN32__
+    munmap(inFile->data, inFile->size);
+#else
+    UnmapViewOfFile(inFile->data);
+#endif
+    free(inFile->fileName);
+    __glcFree(inFile);
+  }
+  __glcUnlock();
+}
+
+
+
+/* Map the font file 'inFileName' in memory in read-only mode. The mappings are
+ * registered in the common area so that a file is mapped only once whatever
+ * the number of contexts and faces that use it : its physical pages are then
+ * shared. Returns NULL if the file can not be mapped, in which case the caller
+ * should read the file the usual way.
+ */
+static __GLCfontFile* __glcFileMap(const GLCchar8* inFileName)
+{
+  FT_ListNode node = NULL;
+  __GLCfontFile* file = NULL;
+  void* data = NULL;
+  FT_Long size = 0;
+#ifndef __WIN32__
+  struct stat fileStat;
+  int fd = -1;
+#else
+  HANDLE handle = INVALID_HANDLE_VALUE;
+  HANDLE mapping = NULL;
+#endif
+
+  __glcLock();
+
+  for (node = __glcCommonArea.fontFileList.head; node; node = node->next) {
+    file = (__GLCfontFile*)node;
+
+    if (!strcmp((const char*)file->fileName, (const char*)inFileName)) {
+      file->refCount++;
+      __glcUnlock();
+      return file;
+    }
+  }
+
+#ifndef __WIN32__
+  fd = open((const char*)inFileName, O_RDONLY);
+  if (fd < 0) {
+    __glcUnlock();
+    return NULL;
+  }
+  if ((fstat(fd, &fileStat) < 0) || (fileStat.st_size <= 0)) {
+    close(fd);
+    __glcUnlock();
+    return NULL;
+  }
+  size = (FT_Long)fileStat.st_size;
+  data = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    __glcUnlock();
+    return NULL;
+  }
+#else
+  handle = CreateFileA((LPCSTR)inFileName, GENERIC_READ, FILE_SHARE_READ, NULL,
+		       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (handle == INVALID_HANDLE_VALUE) {
+    __glcUnlock();
+    return NULL;
+  }
+  size = (FT_Long)GetFileSize(handle, NULL);
+  if ((size <= 0) || (size == (FT_Long)INVALID_FILE_SIZE)) {
+    CloseHandle(handle);
+    __glcUnlock();
+    return NULL;
+  }
+  mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+  CloseHandle(handle);
+  if (!mapping) {
+    __glcUnlock();
+    return NULL;
+  }
+  data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+  if (!data) {
+    __glcUnlock();
+    return NULL;
+  }
+#endif
+
+  file = (__GLCfontFile*)__glcMalloc(sizeof(__GLCfontFile));
+  if (file) {
+    memset(file, 0, sizeof(__GLCfontFile));
+#ifdef __WIN32__
+    file->fileName = (GLCchar8*)_strdup((const char*)inFileName);
+#else
+    file->fileName = (GLCchar8*)strdup((const char*)inFileName);
+#endif
+  }
+  if ((!file) || (!file->fileName)) {
+    if (file)
+      __glcFree(file);
+#ifndef __WIN32__
+    munmap(data, size);
+#else
+    UnmapViewOfFile(data);
+#endif
+    __glcUnlock();
+    return NULL;
+  }
+
+  file->node.data = file;
+  file->data = (FT_Byte*)data;
+  file->size = size;
+  file->refCount = 1;
+  FT_List_Add(&__glcCommonArea.fontFileList, (FT_ListNode)file);
+
+  __glcUnlock();
+  return file;
+}
+
+
+
+/* FreeType calls this function when a face which has been opened by
+ * __glcFileNewFace() is done : the stream has been allocated by QuesoGLC and
+ * it holds a reference to the mapping of the file.
+ */
+static void __glcFileStreamClose(FT_Stream inStream)
+{
+  __glcFileUnmap((__GLCfontFile*)inStream->descriptor.pointer);
+  __glcFree(inStream);
+}
+
+
+
+/* Open the face 'inIndex' of the file 'inFileName'. The face is read from the
+ * shared mapping of the file if the file can be mapped, otherwise FreeType
+ * reads the file by itself.
+ */
+static FT_Error __glcFileNewFace(FT_Library inLibrary,
+				 const GLCchar8* inFileName, const int inIndex,
+				 FT_Face* outFace)
+{
+  __GLCfontFile* file = __glcFileMap(inFileName);
+  FT_Stream stream = NULL;
+  FT_Open_Args args;
+
+  if (!file)
+    return FT_New_Face(inLibrary, (const char*)inFileName, inIndex, outFace);
+
+  stream = (FT_Stream)__glcMalloc(sizeof(FT_StreamRec));
+  if (!stream) {
+    __glcFileUnmap(file);
+    return FT_Err_Out_Of_Memory;
+  }
+  memset(stream, 0, sizeof(FT_StreamRec));
+
+  /* A stream without 'read' function is a memory based stream. The stream is
+   * closed (hence the file unmapped) by FreeType after the face has been
+   * destroyed.
+   */
+  stream->base = file->data;
+  stream->size = (unsigned long)file->size;
+  stream->descriptor.pointer = file;
+  stream->close = __glcFileStreamClose;
+
+  memset(&args, 0, sizeof(FT_Open_Args));
+  args.flags = FT_OPEN_STREAM;
+  args.stream = stream;
+
+  return FT_Open_Face(inLibrary, &args, inIndex, outFace);
+}
+
+
+
 #ifndef GLC_FT_CACHE
 /* Open a face, select a Unicode charmap. __glcFaceDesc maintains a reference
  * count for each face so that the face is open only once.
@@ -250,8 +352,7 @@ FT_Face __glcFaceDescOpen(__GLCfaceDescriptor* This,
     FcPatternGetInteger(This->pattern, FC_INDEX, 0, &index);
 #endif
 
-    if (FT_New_Face(inContext->library, (const char*)fileName, index,
-		    &This->face)) {
+    if (__glcFileNewFace(inContext->library, fileName, index, &This->face)) {
       /* Unable to load the face file */
       __glcRaiseError(GLC_RESOURCE_ERROR);
       return NULL;
@@ -312,7 +413,7 @@ FT_Error __glcFileOpen(FTC_FaceID inFile, FT_Library inLibrary,
   FcPatternGetInteger(file->pattern, FC_INDEX, 0, &fileIndex);
 #endif
 
-  error = FT_New_Face(inLibrary, (const char*)fileName, fileIndex, outFace);
+  error = __glcFileNewFace(inLibrary, fileName, fileIndex, outFace);
 
   if (error) {
     __glcRaiseError(GLC_RESOURCE_ERROR);
@@ -328,6 +429,72 @@ FT_Error __glcFileOpen(FTC_FaceID inFile, FT_Library inLibrary,
 
 
 
+/* Compute the hash value of a key of the hash tables of the face. The bits of
+ * the key are mixed since the keys are usually contiguous (the code points of
+ * a script or the indices of the glyphs of a font).
+ */
+static GLCulong __glcFaceDescHash(GLCulong inKey)
+{
+  inKey = (((inKey >> 16) ^ inKey) * 0x45d9f3b) & 0xffffffff;
+  return (inKey >> 16) ^ inKey;
+}
+
+
+
+/* Get the bucket of the hash table of the glyphs of the face where the glyph
+ * of the code point 'inCode' is stored. If the glyph is not in the table, the
+ * function returns the empty bucket where it should be inserted.
+ * The buckets are probed linearly from the hash value of the code point.
+ */
+static __GLCglyphEntry* __glcFaceDescLookupGlyph(__GLCfaceDescriptor* This,
+						 const GLCulong inCode)
+{
+  const GLCulong mask = This->glyphTableSize - 1;
+  __GLCglyphEntry* entry = NULL;
+
+  for (entry = This->glyphTable + (__glcFaceDescHash(inCode) & mask);
+       entry->glyph && (entry->codepoint != inCode);
+       entry = This->glyphTable + ((entry - This->glyphTable + 1) & mask));
+
+  return entry;
+}
+
+
+
+/* Double the number of buckets of the hash table of the glyphs of the face
+ * and store the glyphs again in the new table.
+ */
+static GLboolean __glcFaceDescGrowGlyphTable(__GLCfaceDescriptor* This)
+{
+  __GLCglyphEntry* oldTable = This->glyphTable;
+  const int oldSize = This->glyphTableSize;
+  int size = oldSize ? oldSize << 1 : 64;
+  int i = 0;
+
+  This->glyphTable = (__GLCglyphEntry*)__glcMalloc(size
+						   * sizeof(__GLCglyphEntry));
+  if (!This->glyphTable) {
+    This->glyphTable = oldTable;
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    return GL_FALSE;
+  }
+
+  memset(This->glyphTable, 0, size * sizeof(__GLCglyphEntry));
+  This->glyphTableSize = size;
+
+  for (i = 0; i < oldSize; i++) {
+    if (oldTable[i].glyph)
+      *__glcFaceDescLookupGlyph(This, oldTable[i].codepoint) = oldTable[i];
+  }
+
+  if (oldTable)
+    __glcFree(oldTable);
+
+  return GL_TRUE;
+}
+
+
+
 /* Return the glyph which corresponds to codepoint 'inCode' */
 __GLCglyph* __glcFaceDescGetGlyph(__GLCfaceDescriptor* This,
 				  const GLint inCode,
@@ -335,14 +502,22 @@ __GLCglyph* __glcFaceDescGetGlyph(__GLCfaceDescriptor* This,
 {
   FT_Face face = NULL;
   __GLCglyph* glyph = NULL;
-  FT_ListNode node = NULL;
+  __GLCglyphEntry* entry = NULL;
   FT_UInt index = 0;
 
   /* Check if the glyph has already been added to the glyph list */
-  for (node = This->glyphList.head; node; node = node->next) {
-    glyph = (__GLCglyph*)node;
-    if (glyph->codepoint == (GLCulong)inCode)
-      return glyph;
+  if (This->glyphTable) {
+    entry = __glcFaceDescLookupGlyph(This, inCode);
+    if (entry->glyph)
+      return entry->glyph;
+  }
+
+  /* Make sure that the hash table has room for the new glyph. The table is
+   * kept at most half full so that the probe sequences remain short.
+   */
+  if (2 * (This->glyphCount + 1) > This->glyphTableSize) {
+    if (!__glcFaceDescGrowGlyphTable(This))
+      return NULL;
   }
 
   /* Open the face */
@@ -375,6 +550,10 @@ __GLCglyph* __glcFaceDescGetGlyph(__GLCfaceDescriptor* This,
    * face.
    */
   FT_List_Add(&This->glyphList, (FT_ListNode)glyph);
+  entry = __glcFaceDescLookupGlyph(This, inCode);
+  entry->codepoint = (GLCulong)inCode;
+  entry->glyph = glyph;
+  This->glyphCount++;
 #ifndef GLC_FT_CACHE
   __glcFaceDescClose(This);
 #endif
@@ -526,6 +705,138 @@ void __glcFaceDescDestroyGLObjects(const __GLCfaceDescriptor* This,
 
 
 
+/* Read the metrics of the glyph 'inGlyphIndex' in the table of the preloaded
+ * metrics of the face (see GLC_PRELOAD_METRICS_QSO). If they are not in the
+ * table yet, the metrics of the whole block of GLC_METRICS_BLOCK_SIZE glyphs
+ * that contains the glyph are read at once: the advances are read with a
+ * single call to FT_Get_Advances() and the bounding boxes are computed from
+ * the outlines in font units, which are neither scaled nor hinted.
+ * The function returns GL_FALSE if the metrics can not be preloaded. They must
+ * then be read from the glyph itself. This is the case of the blocks which
+ * contain glyphs that have no outline (in bitmap-only faces for instance):
+ * such blocks are marked as failed so that they are not read again.
+ */
+static GLboolean __glcFaceDescPreloadMetrics(__GLCfaceDescriptor* This,
+					     const GLCulong inGlyphIndex,
+					     const __GLCcontext* inContext)
+{
+  const GLCulong block = inGlyphIndex / GLC_METRICS_BLOCK_SIZE;
+  FT_Fixed advances[GLC_METRICS_BLOCK_SIZE];
+  FT_Face face = NULL;
+  GLCulong first = 0;
+  GLCulong count = 0;
+  GLCulong i = 0;
+  GLfloat unitsPerEM = 0.f;
+
+  if (This->metricsBlocks) {
+    if (inGlyphIndex >= This->numGlyphs)
+      return GL_FALSE;
+
+    switch (This->metricsBlocks[block]) {
+    case GLC_METRICS_LOADED:
+      return GL_TRUE;
+    case GLC_METRICS_FAILED:
+      return GL_FALSE;
+    }
+  }
+
+  /* Open the face. FT_Load_Glyph() fails if no size is selected, even though
+   * the glyphs are not scaled : a size is thus selected for the face.
+   */
+  if (!__glcFaceDescPrepareFont(This, inContext, GLC_POINT_SIZE,
+				GLC_POINT_SIZE))
+    return GL_FALSE;
+  face = This->face;
+
+  /* The table is allocated when it is first used. If the memory can not be
+   * allocated, the metrics are read glyph by glyph.
+   */
+  if (!This->metricsBlocks) {
+    This->numGlyphs = face->num_glyphs;
+    This->metricsBlocks = (GLubyte*)__glcMalloc((This->numGlyphs
+						 + GLC_METRICS_BLOCK_SIZE - 1)
+						/ GLC_METRICS_BLOCK_SIZE);
+    This->advances = (GLfloat*)__glcMalloc(This->numGlyphs * sizeof(GLfloat));
+    This->boundingBoxes = (GLfloat*)__glcMalloc(4 * This->numGlyphs
+						* sizeof(GLfloat));
+    if (!This->metricsBlocks || !This->advances || !This->boundingBoxes) {
+      if (This->metricsBlocks)
+	__glcFree(This->metricsBlocks);
+      if (This->advances)
+	__glcFree(This->advances);
+      if (This->boundingBoxes)
+	__glcFree(This->boundingBoxes);
+      This->metricsBlocks = NULL;
+      This->advances = NULL;
+      This->boundingBoxes = NULL;
+#ifndef GLC_FT_CACHE
+      __glcFaceDescClose(This);
+#endif
+      return GL_FALSE;
+    }
+
+    memset(This->metricsBlocks, 0, (This->numGlyphs + GLC_METRICS_BLOCK_SIZE
+				    - 1) / GLC_METRICS_BLOCK_SIZE);
+  }
+
+  if (inGlyphIndex >= This->numGlyphs) {
+#ifndef GLC_FT_CACHE
+    __glcFaceDescClose(This);
+#endif
+    return GL_FALSE;
+  }
+
+  first = block * GLC_METRICS_BLOCK_SIZE;
+  count = This->numGlyphs - first;
+  if (count > GLC_METRICS_BLOCK_SIZE)
+    count = GLC_METRICS_BLOCK_SIZE;
+  unitsPerEM = face->units_per_EM;
+
+#ifdef FT_ADVANCES_H
+  if (FT_Get_Advances(face, first, count, FT_LOAD_NO_SCALE, advances)) {
+    This->metricsBlocks[block] = GLC_METRICS_FAILED;
+#ifndef GLC_FT_CACHE
+    __glcFaceDescClose(This);
+#endif
+    return GL_FALSE;
+  }
+#endif
+
+  for (i = 0; i < count; i++) {
+    GLfloat* boundingBox = This->boundingBoxes + 4 * (first + i);
+    FT_BBox boundBox;
+
+    if (FT_Load_Glyph(face, first + i, FT_LOAD_NO_SCALE | FT_LOAD_NO_BITMAP
+		      | FT_LOAD_IGNORE_TRANSFORM)) {
+      This->metricsBlocks[block] = GLC_METRICS_FAILED;
+#ifndef GLC_FT_CACHE
+      __glcFaceDescClose(This);
+#endif
+      return GL_FALSE;
+    }
+
+#ifndef FT_ADVANCES_H
+    advances[i] = face->glyph->advance.x;
+#endif
+    FT_Outline_Get_CBox(&face->glyph->outline, &boundBox);
+
+    This->advances[first + i] = advances[i] / unitsPerEM;
+    boundingBox[0] = boundBox.xMin / unitsPerEM;
+    boundingBox[1] = boundBox.yMin / unitsPerEM;
+    boundingBox[2] = boundBox.xMax / unitsPerEM;
+    boundingBox[3] = boundBox.yMax / unitsPerEM;
+  }
+
+  This->metricsBlocks[block] = GLC_METRICS_LOADED;
+
+#ifndef GLC_FT_CACHE
+  __glcFaceDescClose(This);
+#endif
+  return GL_TRUE;
+}
+
+
+
 /* Get the bounding box of a glyph according to the size given by inScaleX and
  * inScaleY. The result is returned in outVec. 'inGlyphIndex' contains the
  * index of the glyph in the font file.
@@ -541,6 +852,17 @@ GLfloat* __glcFaceDescGetBoundingBox(__GLCfaceDescriptor* This,
 
   assert(outVec);
 
+  /* The preloaded metrics are given in em units, hence they do not depend on
+   * the size of the glyph.
+   */
+  if (inContext->enableState.preloadMetrics
+      && inContext->enableState.glObjects
+      && __glcFaceDescPreloadMetrics(This, inGlyphIndex, inContext)) {
+    memcpy(outVec, This->boundingBoxes + 4 * inGlyphIndex,
+	   4 * sizeof(GLfloat));
+    return outVec;
+  }
+
   if (!__glcFaceDescPrepareGlyph(This, inContext, inScaleX, inScaleY,
 				 inGlyphIndex))
     return NULL;
@@ -577,6 +899,14 @@ GLfloat* __glcFaceDescGetAdvance(__GLCfaceDescriptor* This,
 {
   assert(outVec);
 
+  if (inContext->enableState.preloadMetrics
+      && inContext->enableState.glObjects
+      && __glcFaceDescPreloadMetrics(This, inGlyphIndex, inContext)) {
+    outVec[0] = This->advances[inGlyphIndex];
+    outVec[1] = 0.;
+    return outVec;
+  }
+
   if (!__glcFaceDescPrepareGlyph(This, inContext, inScaleX, inScaleY,
 				 inGlyphIndex))
     return NULL;
@@ -786,6 +1116,118 @@ GLfloat* __glcFaceDescGetMaxMetric(__GLCfaceDescriptor* This, GLfloat* outVec,
 
 
 
+/* Get the bucket of the hash table of the kerning cache where the pair of
+ * glyphs 'inPair' is stored. If the pair is not in the table, the function
+ * returns the empty bucket where it should be inserted.
+ */
+static __GLCkerningEntry* __glcFaceDescLookupKerning(__GLCfaceDescriptor* This,
+						     const GLCuint inPair)
+{
+  const GLCulong mask = This->kerningHashSize - 1;
+  __GLCkerningEntry* entry = NULL;
+
+  for (entry = This->kerningHash + (__glcFaceDescHash(inPair) & mask);
+       entry->pair && (entry->pair != inPair);
+       entry = This->kerningHash + ((entry - This->kerningHash + 1) & mask));
+
+  return entry;
+}
+
+
+
+/* Double the number of buckets of the hash table of the kerning cache of the
+ * face and store the pairs again in the new table.
+ */
+static GLboolean __glcFaceDescGrowKerningHash(__GLCfaceDescriptor* This)
+{
+  __GLCkerningEntry* oldHash = This->kerningHash;
+  const int oldSize = This->kerningHashSize;
+  int size = oldSize ? oldSize << 1 : 256;
+  int i = 0;
+
+  This->kerningHash = (__GLCkerningEntry*)__glcMalloc(size
+					     * sizeof(__GLCkerningEntry));
+  if (!This->kerningHash) {
+    This->kerningHash = oldHash;
+    return GL_FALSE;
+  }
+
+  memset(This->kerningHash, 0, size * sizeof(__GLCkerningEntry));
+  This->kerningHashSize = size;
+
+  for (i = 0; i < oldSize; i++) {
+    if (oldHash[i].pair)
+      *__glcFaceDescLookupKerning(This, oldHash[i].pair) = oldHash[i];
+  }
+
+  if (oldHash)
+    __glcFree(oldHash);
+
+  return GL_TRUE;
+}
+
+
+
+/* Get the state of the pair of glyphs (inPrevGlyphIndex, inGlyphIndex) in the
+ * kerning cache of the face. The pair is added to the cache with the state
+ * GLC_KERNING_UNKNOWN if it is not found. The function returns NULL if the
+ * pair can not be stored in the cache.
+ */
+static GLubyte* __glcFaceDescGetKerningState(__GLCfaceDescriptor* This,
+					     const GLCuint inPrevGlyphIndex,
+					     const GLCuint inGlyphIndex)
+{
+  __GLCkerningEntry* entry = NULL;
+  GLCuint pair = 0;
+
+  if ((inPrevGlyphIndex < GLC_KERNING_TABLE_SIZE)
+      && (inGlyphIndex < GLC_KERNING_TABLE_SIZE)) {
+    if (!This->kerningTable) {
+      This->kerningTable = (GLubyte*)__glcMalloc(GLC_KERNING_TABLE_SIZE
+						 * GLC_KERNING_TABLE_SIZE);
+      if (!This->kerningTable)
+	return NULL;
+      memset(This->kerningTable, GLC_KERNING_UNKNOWN,
+	     GLC_KERNING_TABLE_SIZE * GLC_KERNING_TABLE_SIZE);
+    }
+
+    return This->kerningTable + inPrevGlyphIndex * GLC_KERNING_TABLE_SIZE
+      + inGlyphIndex;
+  }
+
+  /* The glyph index 0 is never used for a character, so the key of a pair is
+   * never 0.
+   */
+  if ((inPrevGlyphIndex > 0xffff) || (inGlyphIndex > 0xffff))
+    return NULL;
+  pair = (inPrevGlyphIndex << 16) | inGlyphIndex;
+
+  /* The hash table is kept at most half full so that the probe sequences
+   * remain short. Once it has reached its maximum size, the new pairs are no
+   * longer cached.
+   */
+  if ((2 * (This->kerningCount + 1) > This->kerningHashSize)
+      && (This->kerningHashSize < GLC_KERNING_HASH_MAX))
+    __glcFaceDescGrowKerningHash(This);
+
+  if (!This->kerningHash)
+    return NULL;
+
+  entry = __glcFaceDescLookupKerning(This, pair);
+  if (!entry->pair) {
+    if (2 * (This->kerningCount + 1) > This->kerningHashSize)
+      return NULL;
+
+    entry->pair = pair;
+    entry->state = GLC_KERNING_UNKNOWN;
+    This->kerningCount++;
+  }
+
+  return &entry->state;
+}
+
+
+
 /* Get the kerning information of a pair of glyphs according to the size given
  * by inScaleX and inScaleY. The result is returned in outVec.
  */
@@ -797,19 +1239,52 @@ GLfloat* __glcFaceDescGetKerning(__GLCfaceDescriptor* This,
 {
   FT_Vector kerning;
   FT_Error error;
+  GLubyte* state = NULL;
 
   assert(outVec);
 
-  if (!__glcFaceDescPrepareGlyph(This, inContext, inScaleX, inScaleY,
-				 inGlyphIndex))
+  outVec[0] = 0.;
+  outVec[1] = 0.;
+
+  /* Most of the pairs of glyphs are not kerned: once a pair is known to be
+   * one of them, FreeType does not need to be queried any more.
+   */
+  state = __glcFaceDescGetKerningState(This, inPrevGlyphIndex, inGlyphIndex);
+  if (state && (*state == GLC_KERNING_NONE))
+    return outVec;
+
+  /* The kerning does not depend on the outline of the glyphs, so only the size
+   * of the face is selected: no glyph is loaded.
+   */
+  if (!__glcFaceDescPrepareFont(This, inContext, inScaleX, inScaleY))
     return NULL;
 
   if (!FT_HAS_KERNING(This->face)) {
-    outVec[0] = 0.;
-    outVec[1] = 0.;
+    if (state)
+      *state = GLC_KERNING_NONE;
+#ifndef GLC_FT_CACHE
+    __glcFaceDescClose(This);
+#endif
     return outVec;
   }
 
+  /* The state of the pair is determined from the kerning in font units since
+   * the kerning of a pair may be rounded to 0 at some sizes only.
+   */
+  if (state && (*state == GLC_KERNING_UNKNOWN)) {
+    error = FT_Get_Kerning(This->face, inPrevGlyphIndex, inGlyphIndex,
+			   FT_KERNING_UNSCALED, &kerning);
+    if (!error)
+      *state = (kerning.x || kerning.y) ? GLC_KERNING_PAIR : GLC_KERNING_NONE;
+
+    if (*state != GLC_KERNING_PAIR) {
+#ifndef GLC_FT_CACHE
+      __glcFaceDescClose(This);
+#endif
+      return error ? NULL : outVec;
+    }
+  }
+
   error = FT_Get_Kerning(This->face, inPrevGlyphIndex, inGlyphIndex,
 			 FT_KERNING_DEFAULT, &kerning);
 
@@ -1007,6 +1482,17 @@ GLboolean __glcFaceDescOutlineDecompose(const __GLCfaceDescriptor* This,
     inData->tolerance *= face->units_per_EM;
   }
 
+  /* Make room at once for the points and the contours of the outline. More
+   * vertices are added later on when the curves are subdivided.
+   */
+  if (!__glcArrayReserve(inData->vertexArray,
+			 GLC_ARRAY_LENGTH(inData->vertexArray)
+			 + outline->n_points)
+      || !__glcArrayReserve(inData->endContour,
+			    GLC_ARRAY_LENGTH(inData->endContour)
+			    + outline->n_contours + 1))
+    return GL_FALSE;
+
   /* Parse the outline of the glyph */
   if (FT_Outline_Decompose(outline, &outlineInterface, inData)) {
     __glcRaiseError(GLC_RESOURCE_ERROR);
@@ -1022,20 +1508,6 @@ GLboolean __glcFaceDescOutlineDecompose(const __GLCfaceDescriptor* This,
 
 
 
-/* Compute the lower power of 2 that is greater than value. It is used to
- * determine the smaller texture than can contain a glyph.
- */
-static int __glcNextPowerOf2(int value)
-{
-  int power = 0;
-
-  for (power = 1; power < value; power <<= 1);
-
-  return power;
-}
-
-
-
 /* Get the size of the bitmap in which the glyph will be rendered */
 GLboolean __glcFaceDescGetBitmapSize(const __GLCfaceDescriptor* This,
 				     GLint* outWidth, GLint *outHeight,
@@ -1104,62 +1576,64 @@ GLboolean __glcFaceDescGetBitmapSize(const __GLCfaceDescriptor* This,
       GLfloat ratioX = 0.f;
       GLfloat ratioY = 0.f;
       GLfloat ratio = 0.f;
+      const GLint maxSize = GLC_ATLAS_MAX_GLYPH_SIZE - 2 * GLC_ATLAS_PADDING;
 
       width = boundingBox.xMax - boundingBox.xMin;
       height = boundingBox.yMax - boundingBox.yMin;
 
-      ratioX = width / (64.f * GLC_TEXTURE_SIZE);
-      ratioY = height / (64.f * GLC_TEXTURE_SIZE);
+      ratioX = width / (64.f * maxSize);
+      ratioY = height / (64.f * maxSize);
 
       ratioX = (ratioX > 1.f) ? ratioX : 1.f;
       ratioY = (ratioY > 1.f) ? ratioY : 1.f;
       ratio = ((ratioX > ratioY) ? ratioX : ratioY);
 
-      *outWidth = GLC_TEXTURE_SIZE;
-      *outHeight = GLC_TEXTURE_SIZE;
-
       outline.flags |= FT_OUTLINE_HIGH_PRECISION;
 
+      /* The glyphs which are too large are scaled down in order to fit in a
+       * GLC_ATLAS_MAX_GLYPH_SIZE x GLC_ATLAS_MAX_GLYPH_SIZE square.
+       */
       if (ratio > 1.f) {
-	outPixBoundingBox[0] = boundingBox.xMin
-	  - ((GLint)((GLC_TEXTURE_SIZE << 5) - (width * 0.5f)) * ratio);
-	outPixBoundingBox[1] = boundingBox.yMin
-	  - ((GLint)((GLC_TEXTURE_SIZE << 5) - (height * 0.5f)) * ratio);
-	outPixBoundingBox[2] = outPixBoundingBox[0]
-	  + ((GLint)((GLC_TEXTURE_SIZE << 6) * ratio));
-	outPixBoundingBox[3] = outPixBoundingBox[1]
-	  + ((GLint)((GLC_TEXTURE_SIZE << 6) * ratio));
-
 	matrix.xx = (FT_Fixed)(65536.f / ratio);
 	matrix.yy = matrix.xx;
 
 	FT_Outline_Transform(&outline, &matrix);
 	FT_Outline_Get_CBox(&outline, &boundingBox);
+
+	width = boundingBox.xMax - boundingBox.xMin;
+	height = boundingBox.yMax - boundingBox.yMin;
       }
-      else {
-	outPixBoundingBox[0] = boundingBox.xMin
-	  - ((GLC_TEXTURE_SIZE << 5) - (width >> 1));
-	outPixBoundingBox[1] = boundingBox.yMin
-	  - ((GLC_TEXTURE_SIZE << 5) - (height >> 1));
-	outPixBoundingBox[2] = outPixBoundingBox[0] + ((GLC_TEXTURE_SIZE - 1) << 6);
-	outPixBoundingBox[3] = outPixBoundingBox[1] + ((GLC_TEXTURE_SIZE - 1) << 6);
-      }
+
+      /* The glyph is stored in the texture atlas in a rectangle that is sized
+       * to its bounding box plus some padding, rounded up to the alignment of
+       * the atlas.
+       */
+      *outWidth = ((((width + 63) >> 6) + 2 * GLC_ATLAS_PADDING
+		    + GLC_ATLAS_ALIGNMENT - 1) / GLC_ATLAS_ALIGNMENT)
+	* GLC_ATLAS_ALIGNMENT;
+      *outHeight = ((((height + 63) >> 6) + 2 * GLC_ATLAS_PADDING
+		     + GLC_ATLAS_ALIGNMENT - 1) / GLC_ATLAS_ALIGNMENT)
+	* GLC_ATLAS_ALIGNMENT;
+
+      outPixBoundingBox[0] = (boundingBox.xMin
+			      - ((*outWidth << 5) - (width >> 1))) * ratio;
+      outPixBoundingBox[1] = (boundingBox.yMin
+			      - ((*outHeight << 5) - (height >> 1))) * ratio;
+      outPixBoundingBox[2] = outPixBoundingBox[0]
+	+ ((*outWidth - 1) << 6) * ratio;
+      outPixBoundingBox[3] = outPixBoundingBox[1]
+	+ ((*outHeight - 1) << 6) * ratio;
     }
     else {
       width = (GLC_CEIL_26_6(boundingBox.xMax)
 	       - GLC_FLOOR_26_6(boundingBox.xMin)) >> 6;
       height = (GLC_CEIL_26_6(boundingBox.yMax)
 		- GLC_FLOOR_26_6(boundingBox.yMin)) >> 6;
-      *outWidth = __glcNextPowerOf2(width);
-      *outHeight = __glcNextPowerOf2(height);
-
-      *outWidth = (*outWidth > inContext->texture.width)
-	? *outWidth : inContext->texture.width;
-      *outHeight = (*outHeight > inContext->texture.height)
-	? *outHeight : inContext->texture.height;
-
-      if (*outWidth - width <= 1) *outWidth <<= 1;
-      if (*outHeight - height <= 1) *outHeight <<= 1;
+      /* The image is sized to the bounding box of the glyph plus some padding
+       * so that it can be stored in the texture cache of the immediate mode.
+       */
+      *outWidth = width + 2 * GLC_ATLAS_PADDING;
+      *outHeight = height + 2 * GLC_ATLAS_PADDING;
 
       /* If the texture size is too small then give up */
       if ((*outWidth < 4) || (*outHeight < 4))
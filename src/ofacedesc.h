@@ -30,6 +30,57 @@
 
 typedef struct __GLCrendererDataRec __GLCrendererData;
 typedef struct __GLCfaceDescriptorRec __GLCfaceDescriptor;
+typedef struct __GLCglyphEntryRec __GLCglyphEntry;
+typedef struct __GLCkerningEntryRec __GLCkerningEntry;
+typedef struct __GLCfontFileRec __GLCfontFile;
+
+/* The kerning cache of a face records which pairs of glyphs are kerned. The
+ * pairs of glyphs which indices are lower than GLC_KERNING_TABLE_SIZE are
+ * stored in a dense table, the other pairs are stored in a hash table of at
+ * most GLC_KERNING_HASH_MAX buckets.
+ */
+#define GLC_KERNING_TABLE_SIZE  128
+#define GLC_KERNING_HASH_MAX    (1 << 16)
+
+/* The metrics of the glyphs are preloaded by blocks of GLC_METRICS_BLOCK_SIZE
+ * consecutive glyphs (see GLC_PRELOAD_METRICS_QSO).
+ */
+#define GLC_METRICS_BLOCK_SIZE  128
+
+/* State of a block of preloaded metrics */
+#define GLC_METRICS_UNKNOWN     0
+#define GLC_METRICS_LOADED      1
+#define GLC_METRICS_FAILED      2
+
+/* State of a pair of glyphs in the kerning cache */
+#define GLC_KERNING_UNKNOWN     0
+#define GLC_KERNING_NONE        1
+#define GLC_KERNING_PAIR        2
+
+/* A bucket of the hash table of the glyphs of a face. The code point is copied
+ * in the bucket so that the table can be probed without reading the glyphs.
+ */
+struct __GLCglyphEntryRec {
+  GLCulong codepoint;
+  __GLCglyph* glyph;		/* NULL if the bucket is empty */
+};
+
+/* A bucket of the hash table of the kerning cache */
+struct __GLCkerningEntryRec {
+  GLCuint pair;			/* Glyph indices of the pair, 0 if empty */
+  GLubyte state;
+};
+
+/* A font file that is mapped in memory. The mappings are shared by all the
+ * faces of all the contexts that use the file.
+ */
+struct __GLCfontFileRec {
+  FT_ListNodeRec node;
+  GLCchar8* fileName;
+  FT_Byte* data;		/* Read-only mapping of the file */
+  FT_Long size;
+  int refCount;			/* Number of faces that use the mapping */
+};
 
 struct __GLCfaceDescriptorRec {
   FT_ListNodeRec node;
@@ -38,7 +89,21 @@ struct __GLCfaceDescriptorRec {
 #ifndef GLC_FT_CACHE
   int faceRefCount;
 #endif
-  FT_ListRec glyphList;
+  FT_ListRec glyphList;		/* Glyphs of the face in creation order */
+  __GLCglyphEntry* glyphTable;	/* Hash table of the glyphs of glyphList */
+  int glyphTableSize;		/* Number of buckets (a power of 2) */
+  int glyphCount;
+  GLubyte* kerningTable;	/* Kerning cache of the first glyphs */
+  __GLCkerningEntry* kerningHash; /* Kerning cache of the other glyphs */
+  int kerningHashSize;
+  int kerningCount;
+  /* Metrics preloaded with GLC_PRELOAD_METRICS_QSO. They are given in em units
+   * and they are indexed by the glyph indices.
+   */
+  GLCulong numGlyphs;
+  GLubyte* metricsBlocks;	/* States of the blocks of metrics */
+  GLfloat* advances;		/* Horizontal advances */
+  GLfloat* boundingBoxes;	/* xMin, yMin, xMax and yMax of the glyphs */
 };
 
 
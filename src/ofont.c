@@ -322,6 +322,7 @@ GLboolean __glcFontFace(__GLCfont* This, const GLCchar8* inFace,
     __glcCharMapDestroy(This->charMap);
 
   This->charMap = newCharMap;
+  __glcContextInvalidateFontCache(inContext);
 
   __glcFaceDescDestroy(This->faceDesc, inContext);
   This->faceDesc = faceDesc;
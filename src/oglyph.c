@@ -28,6 +28,7 @@
 
 #include "internal.h"
 #include "texture.h"
+#include "bitmap.h"
 
 
 
@@ -63,6 +64,13 @@ __GLCglyph* __glcGlyphCreate(const GLCulong inIndex, const GLCulong inCode)
 void __glcGlyphDestroy(__GLCglyph* This, __GLCcontext* inContext)
 {
   __glcGlyphDestroyGLObjects(This, inContext);
+
+  while (This->bitmapObject)
+    __glcReleaseBitmapElement(This->bitmapObject, inContext);
+
+  while (This->textureCacheObject)
+    __glcReleaseTextureCacheElement(This->textureCacheObject, inContext);
+
   __glcFree(This);
 }
 
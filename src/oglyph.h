@@ -29,6 +29,8 @@
 
 typedef struct __GLCglyphRec __GLCglyph;
 typedef struct __GLCatlasElementRec __GLCatlasElement;
+typedef struct __GLCbitmapElementRec __GLCbitmapElement;
+typedef struct __GLCtextureCacheElementRec __GLCtextureCacheElement;
 typedef struct __GLCgeomBatchRec __GLCgeomBatch;
 
 struct __GLCglyphRec {
@@ -43,6 +45,10 @@ struct __GLCglyphRec {
   GLint* contours;
   GLint nGeomBatch;
   __GLCgeomBatch* geomBatches;
+  /* Images cached for GLC_BITMAP and GLC_PIXMAP_QSO */
+  __GLCbitmapElement* bitmapObject;
+  /* Images cached for GLC_TEXTURE when GLC_GL_OBJECTS is disabled */
+  __GLCtextureCacheElement* textureCacheObject;
   /* Measurement infos */
   GLfloat boundingBox[4];
   GLfloat advance[2];
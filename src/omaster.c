@@ -25,117 +25,20 @@
 #include "internal.h"
 #include <string.h>
 
-typedef GLboolean (*__glcPatternProcess)(FcFontSet* inFontSet,
-					 FcPattern* inPattern, int inFont,
-					 void* inData);
-struct __GLCdataRec {
-  const __GLCmaster* master;
-  GLint* index;
-};
-typedef struct __GLCdataRec __GLCdata;
-
-
-static int __glcScanFonts(const __GLCcontext* inContext, FcFontSet** outFontSet,
-			  FcPattern** outPattern,
-			  __glcPatternProcess inPatternProcess, void* inData)
+/* Get the entry of the master index which corresponds to the master ID
+ * 'inMaster'.
+ */
+static const __GLCmasterEntry* __glcMasterGetEntry(const GLint inMaster,
+						   const __GLCcontext* inContext)
 {
-  int font = 0;
-  FcObjectSet* objectSet = NULL;
-  FcFontSet *fontSet = NULL;
-  FcPattern *pattern = FcPatternCreate();
-
-  /* Use Fontconfig to get the default font files */
-  if (!pattern) {
-    __glcRaiseError(GLC_RESOURCE_ERROR);
-    return -1;
-  }
-  objectSet = FcObjectSetBuild(FC_FAMILY, FC_FOUNDRY, FC_OUTLINE, FC_SPACING,
-			       FC_STYLE, NULL);
-  if (!objectSet) {
-    __glcRaiseError(GLC_RESOURCE_ERROR);
-    FcPatternDestroy(pattern);
-    return -1;
-  }
-  fontSet = FcFontList(inContext->config, pattern, objectSet);
-  FcObjectSetDestroy(objectSet);
-  FcPatternDestroy(pattern);
-  if (!fontSet) {
+  if ((!inContext->masterIndex) || (inMaster < 0)
+      || (inMaster >= inContext->masterIndexLength)
+      || (!inContext->masterIndex[inMaster].pattern)) {
     __glcRaiseError(GLC_RESOURCE_ERROR);
-    return -1;
-  }
-
-  /* Parse the font set looking for a font with an outline and which hash value
-   * matches the hash value of the master we are looking for.
-   */
-  for (font = 0; font < fontSet->nfont; font++) {
-    FcBool outline = FcFalse;
-    FcChar8* family = NULL;
-    int fixed = 0;
-    FcChar8* foundry = NULL;
-#ifdef DEBUGMODE
-    FcResult result = FcResultMatch;
-
-    result = FcPatternGetBool(fontSet->fonts[font], FC_OUTLINE, 0, &outline);
-    assert(result != FcResultTypeMismatch);
-#else
-    FcPatternGetBool(fontSet->fonts[font], FC_OUTLINE, 0, &outline);
-#endif
-    if (!outline)
-      continue;
-
-#ifdef DEBUGMODE
-    result = FcPatternGetString(fontSet->fonts[font], FC_FAMILY, 0, &family);
-    assert(result != FcResultTypeMismatch);
-    result = FcPatternGetString(fontSet->fonts[font], FC_FOUNDRY, 0, &foundry);
-    assert(result != FcResultTypeMismatch);
-    result = FcPatternGetInteger(fontSet->fonts[font], FC_SPACING, 0, &fixed);
-    assert(result != FcResultTypeMismatch);
-#else
-    FcPatternGetString(fontSet->fonts[font], FC_FAMILY, 0, &family);
-    FcPatternGetString(fontSet->fonts[font], FC_FOUNDRY, 0, &foundry);
-    FcPatternGetInteger(fontSet->fonts[font], FC_SPACING, 0, &fixed);
-#endif
-
-    if (foundry)
-      pattern = FcPatternBuild(NULL, FC_FAMILY, FcTypeString, family,
-			       FC_FOUNDRY, FcTypeString, foundry, FC_SPACING,
-			       FcTypeInteger, fixed, NULL);
-    else
-      pattern = FcPatternBuild(NULL, FC_FAMILY, FcTypeString, family,
-			       FC_SPACING, FcTypeInteger, fixed, NULL);
-
-    if (!pattern) {
-      __glcRaiseError(GLC_RESOURCE_ERROR);
-      FcFontSetDestroy(fontSet);
-      return -1;
-    }
-
-    if (inPatternProcess(fontSet, pattern, font, inData)) {
-      *outPattern = pattern;
-      *outFontSet = fontSet;
-      return font;
-    }
-
-    FcPatternDestroy(pattern);
+    return NULL;
   }
 
-  *outPattern = NULL;
-  *outFontSet = fontSet;
-  return font;
-}
-
-
-
-static GLboolean __glcCheckHashValue(FcFontSet* GLC_UNUSED_ARG(inFontSet),
-				     FcPattern* inPattern,
-				     int GLC_UNUSED_ARG(inFont), void* inData)
-{
-  GLCchar32 hashValue = *((GLCchar32*)inData);
-
-  if (hashValue == FcPatternHash(inPattern))
-    return GL_TRUE;
-
-  return GL_FALSE;
+  return &inContext->masterIndex[inMaster];
 }
 
 
@@ -147,31 +50,23 @@ __GLCmaster* __glcMasterCreate(const GLint inMaster,
 			       const __GLCcontext* inContext)
 {
   __GLCmaster* This = NULL;
-  GLCchar32 hashValue =
-	((GLCchar32*)GLC_ARRAY_DATA(inContext->masterHashTable))[inMaster];
-  FcFontSet *fontSet = NULL;
-  FcPattern *pattern = NULL;
-  int font = __glcScanFonts(inContext, &fontSet, &pattern, __glcCheckHashValue,
-			    &hashValue);
+  const __GLCmasterEntry* entry = __glcMasterGetEntry(inMaster, inContext);
 
-  assert(font < fontSet->nfont);
-
-  FcFontSetDestroy(fontSet);
-  if (font < 0)
+  if (!entry)
     return NULL;
 
   This = (__GLCmaster*)__glcMalloc(sizeof(__GLCmaster));
   if (!This) {
     __glcRaiseError(GLC_RESOURCE_ERROR);
-    FcPatternDestroy(pattern);
     return NULL;
   }
   memset(This, 0, sizeof(__GLCmaster));
 
-  /* Duplicate the pattern of the found font (otherwise it will be deleted with
-   * the font set).
+  /* The pattern is shared with the master index : a reference is taken so
+   * that it remains valid if the index is rebuilt while the master exists.
    */
-  This->pattern = pattern;
+  FcPatternReference(entry->pattern);
+  This->pattern = entry->pattern;
   return This;
 }
 
@@ -187,22 +82,111 @@ void __glcMasterDestroy(__GLCmaster* This)
 
 
 
-static GLboolean __glcFindMasterIndex(FcFontSet* GLC_UNUSED_ARG(inFontSet),
-				      FcPattern* inPattern,
-				      int GLC_UNUSED_ARG(inFont), void* inData)
+/* Get the Fontconfig pattern of the face identified by inIndex. The pattern
+ * belongs to the master index of the context and must not be destroyed.
+ */
+FcPattern* __glcMasterGetFacePattern(const __GLCmaster* This,
+				     const __GLCcontext* inContext,
+				     const GLint inIndex)
 {
-  const __GLCmaster* This = ((__GLCdata*)inData)->master;
-  GLint *idx = ((__GLCdata*)inData)->index;
-  FcBool equal = FcPatternEqual(inPattern, This->pattern);
+  const __GLCmasterEntry* entry = NULL;
 
-  if (equal) {
-    if (*idx)
-      (*idx)--;
-    else
-      return GL_TRUE;
+  entry = __glcMasterGetEntry(__glcMasterGetID(This, inContext), inContext);
+  if (!entry)
+    return NULL;
+
+  if ((inIndex < 0) || (inIndex >= entry->faceCount)) {
+    __glcRaiseError(GLC_PARAMETER_ERROR);
+    return NULL;
+  }
+
+  return inContext->masterFontSet->fonts[inContext->masterFaces[
+						entry->firstFace + inIndex]];
+}
+
+
+
+/* Get the Fontconfig pattern of the font identified by inIndex among all the
+ * fonts of the master (including the fonts which share the style of another
+ * font). The pattern belongs to the master index of the context and must not
+ * be destroyed.
+ */
+FcPattern* __glcMasterGetFontPatternByIndex(const __GLCmaster* This,
+					    const __GLCcontext* inContext,
+					    const GLint inIndex)
+{
+  const __GLCmasterEntry* entry = NULL;
+
+  entry = __glcMasterGetEntry(__glcMasterGetID(This, inContext), inContext);
+  if (!entry)
+    return NULL;
+
+  if ((inIndex < 0) || (inIndex >= entry->fontCount)) {
+    __glcRaiseError(GLC_PARAMETER_ERROR);
+    return NULL;
+  }
+
+  return inContext->masterFontSet->fonts[inContext->masterFonts[
+						entry->firstFace + inIndex]];
+}
+
+
+
+/* Get the Fontconfig pattern of the first font of the master which has the
+ * style 'inFace' (if not NULL) and which maps the character 'inCode' (if not
+ * null). The fonts are looked up in the master index hence the cost does not
+ * depend on the number of fonts of the catalogs. The pattern belongs to the
+ * master index of the context and must not be destroyed.
+ */
+FcPattern* __glcMasterGetFontPattern(const __GLCmaster* This,
+				     const __GLCcontext* inContext,
+				     const GLCchar8* inFace,
+				     const GLint inCode)
+{
+  const __GLCmasterEntry* entry = NULL;
+  int i = 0;
+
+  entry = __glcMasterGetEntry(__glcMasterGetID(This, inContext), inContext);
+  if (!entry)
+    return NULL;
+
+  for (i = 0; i < entry->fontCount; i++) {
+    FcPattern* pattern = inContext->masterFontSet->fonts[inContext->masterFonts[
+						entry->firstFace + i]];
+    FcCharSet* charSet = NULL;
+    FcChar8* style = NULL;
+#ifdef DEBUGMODE
+    FcResult result = FcResultMatch;
+#endif
+
+    /* Check that the code is included in the font */
+    if (inCode) {
+#ifdef DEBUGMODE
+      result = FcPatternGetCharSet(pattern, FC_CHARSET, 0, &charSet);
+      assert(result != FcResultTypeMismatch);
+#else
+      FcPatternGetCharSet(pattern, FC_CHARSET, 0, &charSet);
+#endif
+      if (!FcCharSetHasChar(charSet, inCode))
+	continue;
+    }
+
+    if (inFace) {
+#ifdef DEBUGMODE
+      result = FcPatternGetString(pattern, FC_STYLE, 0, &style);
+      assert(result != FcResultTypeMismatch);
+#else
+      FcPatternGetString(pattern, FC_STYLE, 0, &style);
+#endif
+      if (strcmp((const char*)style, (const char*)inFace))
+	continue;
+    }
+
+    return pattern;
   }
 
-  return GL_FALSE;
+  __glcRaiseError(GLC_RESOURCE_ERROR);
+  return NULL;
 }
 
 
@@ -212,41 +196,21 @@ GLCchar8* __glcMasterGetFaceName(const __GLCmaster* This,
 				 const __GLCcontext* inContext,
 				 const GLint inIndex)
 {
-  FcFontSet *fontSet = NULL;
-  FcPattern *pattern = NULL;
   GLCchar8* string = NULL;
   GLCchar8* faceName;
-  GLint idx = inIndex;
-  __GLCdata data = {NULL, NULL};
-  int font = 0;
+  FcPattern* face = __glcMasterGetFacePattern(This, inContext, inIndex);
 #ifdef DEBUGMODE
   FcResult result = FcResultMatch;
 #endif
 
-  data.master = This;
-  data.index = &idx;
-
-  font = __glcScanFonts(inContext, &fontSet, &pattern, __glcFindMasterIndex,
-			&data);
-
-  FcPatternDestroy(pattern);
-
-  if (font < 0) {
-    FcFontSetDestroy(fontSet);
+  if (!face)
     return NULL;
-  }
-
-  if (font == fontSet->nfont) {
-    __glcRaiseError(GLC_PARAMETER_ERROR);
-    FcFontSetDestroy(fontSet);
-    return NULL;
-  }
 
 #ifdef DEBUGMODE
-  result = FcPatternGetString(fontSet->fonts[font], FC_STYLE, 0, &string);
+  result = FcPatternGetString(face, FC_STYLE, 0, &string);
   assert(result != FcResultTypeMismatch);
 #else
-  FcPatternGetString(fontSet->fonts[font], FC_STYLE, 0, &string);
+  FcPatternGetString(face, FC_STYLE, 0, &string);
 #endif
 
 #ifdef __WIN32__
@@ -254,7 +218,6 @@ GLCchar8* __glcMasterGetFaceName(const __GLCmaster* This,
 #else
   faceName = (GLCchar8*)strdup((const char*)string);
 #endif
-  FcFontSetDestroy(fontSet);
   if (!faceName) {
     __glcRaiseError(GLC_RESOURCE_ERROR);
     return NULL;
@@ -282,43 +245,32 @@ GLboolean __glcMasterIsFixedPitch(const __GLCmaster* This)
 
 
 
-static GLboolean __glcCountFaces(FcFontSet* GLC_UNUSED_ARG(inFontSet),
-				 FcPattern* inPattern,
-				 int GLC_UNUSED_ARG(inFont), void* inData)
+/* Get the face count of the master */
+GLint __glcMasterFaceCount(const __GLCmaster* This,
+			   const __GLCcontext* inContext)
 {
-  const __GLCmaster* This = ((__GLCdata*)inData)->master;
-  GLint *count = ((__GLCdata*)inData)->index;
-  FcBool equal = FcPatternEqual(inPattern, This->pattern);
+  const __GLCmasterEntry* entry = NULL;
 
-  if (equal)
-    (*count)++;
+  entry = __glcMasterGetEntry(__glcMasterGetID(This, inContext), inContext);
+  if (!entry)
+    return 0;
 
-  return GL_FALSE;
+  return entry->faceCount;
 }
 
 
 
-/* Get the face count of the master */
-GLint __glcMasterFaceCount(const __GLCmaster* This,
+/* Get the font count of the master */
+GLint __glcMasterFontCount(const __GLCmaster* This,
 			   const __GLCcontext* inContext)
 {
-  FcFontSet *fontSet = NULL;
-  GLint count = 0;
-  FcPattern* pattern = NULL;
-  __GLCdata data = {NULL, NULL};
-  int font = 0;
-
-  data.master = This;
-  data.index = &count;
-
-  font = __glcScanFonts(inContext, &fontSet, &pattern, __glcCountFaces, &data);
-
-  FcFontSetDestroy(fontSet);
+  const __GLCmasterEntry* entry = NULL;
 
-  if (font < 0)
+  entry = __glcMasterGetEntry(__glcMasterGetID(This, inContext), inContext);
+  if (!entry)
     return 0;
 
-  return count;
+  return entry->fontCount;
 }
 
 
@@ -401,100 +353,75 @@ const GLCchar8* __glcMasterGetInfo(const __GLCmaster* This,
 
 
 
-static GLboolean __glcFindFamily(FcFontSet* inFontSet,
-				 FcPattern* GLC_UNUSED_ARG(inPattern),
-				 int inFont, void* inData)
-{
-  FcChar8* family = NULL;
-#ifdef DEBUGMODE
-  FcResult result = FcPatternGetString(inFontSet->fonts[inFont], FC_FAMILY, 0,
-				       &family);
-  assert(result != FcResultTypeMismatch);
-#else
-  FcPatternGetString(inFontSet->fonts[inFont], FC_FAMILY, 0, &family);
-#endif
-
-  if (strcmp((const char*)family, (const char*)inData))
-    return GL_FALSE;
-
-  return GL_TRUE;
-}
-
-
-
-/* Create a master on the basis of the family name */
+/* Create a master on the basis of the family name. If several masters have
+ * the same family name, the master of the first font of the catalogs with
+ * that family name is chosen.
+ */
 __GLCmaster* __glcMasterFromFamily(const __GLCcontext* inContext,
 				   const GLCchar8* inFamily)
 {
-  FcFontSet *fontSet = NULL;
-  FcPattern* pattern = NULL;
-  __GLCmaster* This = NULL;
-  int font = __glcScanFonts(inContext, &fontSet, &pattern, __glcFindFamily,
-			    (void*)inFamily);
+  GLint master = -1;
+  GLint i = 0;
 
-  if (font < 0) {
-    if (pattern)
-      FcPatternDestroy(pattern);
-    FcFontSetDestroy(fontSet);
+  if (!inContext->masterIndex) {
+    __glcRaiseError(GLC_RESOURCE_ERROR);
     return NULL;
   }
 
-  assert(fontSet);
+  for (i = 0; i < inContext->masterIndexLength; i++) {
+    const __GLCmasterEntry* entry = &inContext->masterIndex[i];
+    FcChar8* family = NULL;
+#ifdef DEBUGMODE
+    FcResult result = FcResultMatch;
+#endif
 
-  if (font == fontSet->nfont) {
-    __glcRaiseError(GLC_PARAMETER_ERROR);
-    if (pattern)
-      FcPatternDestroy(pattern);
-    FcFontSetDestroy(fontSet);
-    return NULL;
-  }
+    if (!entry->pattern)
+      continue;
 
-  assert(pattern);
+#ifdef DEBUGMODE
+    result = FcPatternGetString(entry->pattern, FC_FAMILY, 0, &family);
+    assert(result != FcResultTypeMismatch);
+#else
+    FcPatternGetString(entry->pattern, FC_FAMILY, 0, &family);
+#endif
 
-  This = (__GLCmaster*)__glcMalloc(sizeof(__GLCmaster));
-  if (!This) {
-    __glcRaiseError(GLC_RESOURCE_ERROR);
-    FcFontSetDestroy(fontSet);
-    FcPatternDestroy(pattern);
+    if (strcmp((const char*)family, (const char*)inFamily))
+      continue;
+
+    if ((master < 0) || (inContext->masterFaces[entry->firstFace]
+			 < inContext->masterFaces[
+				inContext->masterIndex[master].firstFace]))
+      master = i;
+  }
+
+  if (master < 0) {
+    __glcRaiseError(GLC_PARAMETER_ERROR);
     return NULL;
   }
-  memset(This, 0, sizeof(__GLCmaster));
 
-  This->pattern = pattern;
-  FcFontSetDestroy(fontSet);
-  return This;
+  return __glcMasterCreate(master, inContext);
 }
 
 
 
-/* Create a master which contains at least a font which math the character
- * identified by inCode.
+/* Get the fonts that can be used to render a character which is not mapped by
+ * the fonts of GLC_CURRENT_FONT_LIST, sorted from the best match to the worst
+ * one. Fontconfig ranks the character set of the fonts before any of the other
+ * properties that are compared, so the first font of this list that maps a
+ * code is also the first font that FcFontSort() would return for a pattern
+ * that contains that code. The list can therefore be computed once and shared
+ * by all the codes : it is kept in the context until the catalogs change.
  */
-__GLCmaster* __glcMasterMatchCode(const __GLCcontext* inContext,
-				  const GLint inCode)
+static FcFontSet* __glcMasterGetFallbackFontSet(__GLCcontext* inContext)
 {
-  __GLCmaster* This = NULL;
   FcPattern* pattern = NULL;
   FcFontSet* fontSet = NULL;
-  FcFontSet* fontSet2 = NULL;
-  FcObjectSet* objectSet = NULL;
   FcResult result = FcResultMatch;
-  int f = 0;
-  FcChar8* family = NULL;
-  int fixed = 0;
-  FcChar8* foundry = NULL;
-  FcCharSet* charSet = FcCharSetCreate();
 
-  if (!charSet)
-    return NULL;
+  if (inContext->fallbackFontSet)
+    return inContext->fallbackFontSet;
 
-  if (!FcCharSetAddChar(charSet, inCode)) {
-    FcCharSetDestroy(charSet);
-    return NULL;
-  }
-  pattern = FcPatternBuild(NULL, FC_CHARSET, FcTypeCharSet, charSet,
-			   FC_OUTLINE, FcTypeBool, FcTrue, NULL);
-  FcCharSetDestroy(charSet);
+  pattern = FcPatternBuild(NULL, FC_OUTLINE, FcTypeBool, FcTrue, NULL);
   if (!pattern) {
     __glcRaiseError(GLC_RESOURCE_ERROR);
     return NULL;
@@ -509,10 +436,41 @@ __GLCmaster* __glcMasterMatchCode(const __GLCcontext* inContext,
   fontSet = FcFontSort(inContext->config, pattern, FcFalse, NULL, &result);
   FcPatternDestroy(pattern);
   if ((!fontSet) || (result == FcResultTypeMismatch)) {
+    if (fontSet)
+      FcFontSetDestroy(fontSet);
     __glcRaiseError(GLC_RESOURCE_ERROR);
     return NULL;
   }
 
+  inContext->fallbackFontSet = fontSet;
+  return fontSet;
+}
+
+
+
+/* Create a master which contains at least a font which math the character
+ * identified by inCode.
+ */
+__GLCmaster* __glcMasterMatchCode(__GLCcontext* inContext, const GLint inCode)
+{
+  __GLCmaster* This = NULL;
+  FcFontSet* fontSet = NULL;
+  FcFontSet* fontSet2 = NULL;
+  FcObjectSet* objectSet = NULL;
+#ifdef DEBUGMODE
+  FcResult result = FcResultMatch;
+#endif
+  FcPattern* pattern = NULL;
+  int f = 0;
+  FcChar8* family = NULL;
+  int fixed = 0;
+  FcChar8* foundry = NULL;
+  FcCharSet* charSet = NULL;
+
+  fontSet = __glcMasterGetFallbackFontSet(inContext);
+  if (!fontSet)
+    return NULL;
+
   for (f = 0; f < fontSet->nfont; f++) {
     FcBool outline = FcFalse;
 
@@ -531,7 +489,10 @@ __GLCmaster* __glcMasterMatchCode(const __GLCcontext* inContext,
   }
 
   if (f == fontSet->nfont) {
-    FcFontSetDestroy(fontSet);
+    /* No font maps the code : remember it in order not to scan the fonts
+     * again the next time the code is looked up.
+     */
+    __glcContextAddUnmappedCode(inContext, inCode);
     return NULL;
   }
 
@@ -542,14 +503,12 @@ __GLCmaster* __glcMasterMatchCode(const __GLCcontext* inContext,
 			       NULL);
   if (!objectSet) {
     __glcRaiseError(GLC_RESOURCE_ERROR);
-    FcFontSetDestroy(fontSet);
     return NULL;
   }
   fontSet2 = FcFontList(inContext->config, fontSet->fonts[f], objectSet);
   FcObjectSetDestroy(objectSet);
   if (!fontSet2) {
     __glcRaiseError(GLC_RESOURCE_ERROR);
-    FcFontSetDestroy(fontSet);
     return NULL;
   }
 
@@ -558,7 +517,6 @@ __GLCmaster* __glcMasterMatchCode(const __GLCcontext* inContext,
   This = (__GLCmaster*)__glcMalloc(sizeof(__GLCmaster));
   if (!This) {
     __glcRaiseError(GLC_RESOURCE_ERROR);
-    FcFontSetDestroy(fontSet);
     FcFontSetDestroy(fontSet2);
     return NULL;
   }
@@ -589,7 +547,6 @@ __GLCmaster* __glcMasterMatchCode(const __GLCcontext* inContext,
 			     FcTypeInteger, fixed, NULL);
 
   FcFontSetDestroy(fontSet2);
-  FcFontSetDestroy(fontSet);
   if (!pattern) {
     __glcRaiseError(GLC_RESOURCE_ERROR);
     __glcFree(This);
@@ -604,15 +561,9 @@ __GLCmaster* __glcMasterMatchCode(const __GLCcontext* inContext,
 
 GLint __glcMasterGetID(const __GLCmaster* This, const __GLCcontext* inContext)
 {
-  GLCchar32 hashValue = GLC_MASTER_HASH_VALUE(This);
-  GLint i = 0;
-  GLCchar32* hashTable = (GLCchar32*)GLC_ARRAY_DATA(inContext->masterHashTable);
+  GLint id = __glcContextGetMasterID(inContext, GLC_MASTER_HASH_VALUE(This));
 
-  for (i = 0; i < GLC_ARRAY_LENGTH(inContext->masterHashTable); i++) {
-    if (hashValue == hashTable[i])
-      break;
-  }
-  assert(i < GLC_ARRAY_LENGTH(inContext->masterHashTable));
+  assert(id >= 0);
 
-  return i;
+  return id;
 }
@@ -38,18 +38,29 @@ struct __GLCmasterRec {
 __GLCmaster* __glcMasterCreate(const GLint inMaster,
 			       const __GLCcontext* inContext);
 void __glcMasterDestroy(__GLCmaster* This);
+FcPattern* __glcMasterGetFacePattern(const __GLCmaster* This,
+				     const __GLCcontext* inContext,
+				     const GLint inIndex);
+FcPattern* __glcMasterGetFontPattern(const __GLCmaster* This,
+				     const __GLCcontext* inContext,
+				     const GLCchar8* inFace,
+				     const GLint inCode);
+FcPattern* __glcMasterGetFontPatternByIndex(const __GLCmaster* This,
+					    const __GLCcontext* inContext,
+					    const GLint inIndex);
 GLCchar8* __glcMasterGetFaceName(const __GLCmaster* This,
 				 const __GLCcontext* inContext,
 				 const GLint inIndex);
 GLboolean __glcMasterIsFixedPitch(const __GLCmaster* This);
 GLint __glcMasterFaceCount(const __GLCmaster* This,
 			   const __GLCcontext* inContext);
+GLint __glcMasterFontCount(const __GLCmaster* This,
+			   const __GLCcontext* inContext);
 const GLCchar8* __glcMasterGetInfo(const __GLCmaster* This,
 				   __GLCcontext* inContext,
 				   const GLCenum inAttrib);
 __GLCmaster* __glcMasterFromFamily(const __GLCcontext* inContext,
 				   const GLCchar8* inFamily);
-__GLCmaster* __glcMasterMatchCode(const __GLCcontext* inContext,
-				  const GLint inCode);
+__GLCmaster* __glcMasterMatchCode(__GLCcontext* inContext, const GLint inCode);
 GLint __glcMasterGetID(const __GLCmaster* This, const __GLCcontext* inContext);
 #endif
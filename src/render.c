@@ -90,37 +90,19 @@
 #include <math.h>
 
 #include "texture.h"
+#include "bitmap.h"
 
 
 
 /* This internal function renders a glyph using the GLC_BITMAP format */
 /* TODO: Render Bitmap fonts */
-static void __glcRenderCharBitmap(const __GLCfont* inFont,
+static void __glcRenderCharBitmap(const __GLCbitmapElement* inImage,
 				  const __GLCcontext* inContext,
-                                  const GLfloat inScaleX,
-				  const GLfloat inScaleY,
 				  const GLfloat* inAdvance,
 				  const GLboolean inIsRTL)
 {
   GLfloat *transform = inContext->bitmapMatrix;
-  GLint pixWidth = 0, pixHeight = 0;
-  GLubyte* pixBuffer = NULL;
-  GLint pixBoundingBox[4] = {0, 0, 0, 0};
-
-  __glcFontGetBitmapSize(inFont, &pixWidth, &pixHeight, inScaleX, inScaleY, 0,
-			 pixBoundingBox, inContext);
-
-  pixBuffer = (GLubyte *)__glcMalloc(pixWidth * pixHeight);
-  if (!pixBuffer) {
-    __glcRaiseError(GLC_RESOURCE_ERROR);
-    return;
-  }
-
-  /* render the glyph */
-  if (!__glcFontGetBitmap(inFont, pixWidth, pixHeight, pixBuffer, inContext)) {
-    __glcFree(pixBuffer);
-    return;
-  }
+  const GLint* pixBoundingBox = inImage->boundingBox;
 
   /* Do the actual GL rendering */
   if (inIsRTL) {
@@ -128,47 +110,27 @@ static void __glcRenderCharBitmap(const __GLCfont* inFont,
 	     inAdvance[1] * transform[2] - inAdvance[0] * transform[0],
 	     inAdvance[1] * transform[3] - inAdvance[0] * transform[1],
 	     NULL);
-    glBitmap(pixWidth, pixHeight, - pixBoundingBox[0] >> 6,
-	     -pixBoundingBox[1] >> 6, 0., 0., pixBuffer);
+    glBitmap(inImage->width, inImage->height, - pixBoundingBox[0] >> 6,
+	     -pixBoundingBox[1] >> 6, 0., 0., inImage->buffer);
   }
   else
-    glBitmap(pixWidth, pixHeight, -pixBoundingBox[0] >> 6,
+    glBitmap(inImage->width, inImage->height, -pixBoundingBox[0] >> 6,
 	     -pixBoundingBox[1] >> 6,
 	     inAdvance[0] * transform[0] + inAdvance[1] * transform[2],
 	     inAdvance[0] * transform[1] + inAdvance[1] * transform[3],
-	     pixBuffer);
-
-  __glcFree(pixBuffer);
+	     inImage->buffer);
 }
 
 
 
 /* This internal function renders a glyph using the GLC_PIXMAP_QSO format */
-static void __glcRenderCharPixmap(const __GLCfont* inFont,
+static void __glcRenderCharPixmap(const __GLCbitmapElement* inImage,
 				  const __GLCcontext* inContext,
-                                  const GLfloat scaleX, const GLfloat scaleY,
                                   const GLfloat* advance,
 				  const GLboolean inIsRTL)
 {
   GLfloat *transform = inContext->bitmapMatrix;
-  GLint pixWidth = 0, pixHeight = 0;
-  GLubyte* pixBuffer = NULL;
-  GLint pixBoundingBox[4] = {0, 0, 0, 0};
-
-  __glcFontGetBitmapSize(inFont, &pixWidth, &pixHeight, scaleX, scaleY, 0,
-			 pixBoundingBox, inContext);
-
-  pixBuffer = (GLubyte *)__glcMalloc(pixWidth * pixHeight);
-  if (!pixBuffer) {
-    __glcRaiseError(GLC_RESOURCE_ERROR);
-    return;
-  }
-
-  /* render the glyph */
-  if (!__glcFontGetBitmap(inFont, pixWidth, pixHeight, pixBuffer, inContext)) {
-    __glcFree(pixBuffer);
-    return;
-  }
+  const GLint* pixBoundingBox = inImage->boundingBox;
 
   /* Do the actual GL rendering */
   if (inIsRTL) {
@@ -179,7 +141,8 @@ static void __glcRenderCharPixmap(const __GLCfont* inFont,
 	     (pixBoundingBox[1] >> 6),
 	     NULL);
 
-    glDrawPixels(pixWidth, pixHeight, GL_ALPHA, GL_UNSIGNED_BYTE, pixBuffer);
+    glDrawPixels(inImage->width, inImage->height, GL_ALPHA, GL_UNSIGNED_BYTE,
+		 inImage->buffer);
 
     glBitmap(0, 0, 0.f, 0.f,
 	     -(pixBoundingBox[0] >> 6),
@@ -192,7 +155,8 @@ static void __glcRenderCharPixmap(const __GLCfont* inFont,
 	     pixBoundingBox[1] >> 6,
 	     NULL);
 
-    glDrawPixels(pixWidth, pixHeight, GL_ALPHA, GL_UNSIGNED_BYTE, pixBuffer);
+    glDrawPixels(inImage->width, inImage->height, GL_ALPHA, GL_UNSIGNED_BYTE,
+		 inImage->buffer);
 
     glBitmap(0, 0, 0.f, 0.f,
 	     advance[0] * transform[0] + advance[1] * transform[2] -
@@ -201,8 +165,6 @@ static void __glcRenderCharPixmap(const __GLCfont* inFont,
 	     (pixBoundingBox[1] >> 6),
 	     NULL);
   }
-
-  __glcFree(pixBuffer);
 }
 
 
@@ -220,6 +182,7 @@ static void* __glcRenderChar(const GLint inCode, const GLint inPrevCode,
   GLfloat scaleX = GLC_POINT_SIZE;
   GLfloat scaleY = GLC_POINT_SIZE;
   __GLCglyph* glyph = NULL;
+  __GLCbitmapElement* image = NULL;
   GLfloat sx64 = 0., sy64 = 0.;
   GLfloat advance[2] = {0., 0.};
 
@@ -269,7 +232,14 @@ static void* __glcRenderChar(const GLint inCode, const GLint inPrevCode,
   /* Get and load the glyph which unicode code is identified by inCode */
   glyph = __glcFontGetGlyph(inFont, inCode, inContext);
 
-  if (inContext->enableState.glObjects
+  /* The images of the glyphs rendered with GLC_BITMAP and GLC_PIXMAP_QSO are
+   * cached. If the image is found then the glyph does not need to be loaded.
+   */
+  if ((inContext->renderState.renderStyle == GLC_BITMAP)
+      || (inContext->renderState.renderStyle == GLC_PIXMAP_QSO))
+    image = __glcBitmapCacheLookup(inContext, glyph, scaleX, scaleY);
+
+  if (inContext->enableState.glObjects && !image
       && !__glcFontPrepareGlyph(inFont, inContext, scaleX, scaleY,
 				glyph->index)) {
 #ifndef GLC_FT_CACHE
@@ -311,12 +281,16 @@ static void* __glcRenderChar(const GLint inCode, const GLint inPrevCode,
   /* Call the appropriate function depending on the rendering mode */
   switch(inContext->renderState.renderStyle) {
   case GLC_BITMAP:
-    __glcRenderCharBitmap(inFont, inContext, scaleX, scaleY, advance,
-			  inIsRTL);
+    if (!image)
+      image = __glcBitmapCacheCreate(inFont, inContext, glyph, scaleX, scaleY);
+    if (image)
+      __glcRenderCharBitmap(image, inContext, advance, inIsRTL);
     break;
   case GLC_PIXMAP_QSO:
-    __glcRenderCharPixmap(inFont, inContext, scaleX, scaleY, advance,
-			  inIsRTL);
+    if (!image)
+      image = __glcBitmapCacheCreate(inFont, inContext, glyph, scaleX, scaleY);
+    if (image)
+      __glcRenderCharPixmap(image, inContext, advance, inIsRTL);
     break;
   case GLC_TEXTURE:
     __glcRenderCharTexture(inFont, inContext, scaleX, scaleY, glyph);
@@ -419,8 +393,9 @@ static void __glcRenderCountedString(__GLCcontext* inContext,
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
     if (inContext->enableState.glObjects) {
-      if (inContext->atlas.id)
-	glBindTexture(GL_TEXTURE_2D, inContext->atlas.id);
+      /* The texture of each page of the atlas is bound when the glyphs that
+       * it stores are rendered.
+       */
       if (GLEW_ARB_vertex_buffer_object) {
 	if (inContext->atlas.bufferObjectID) {
 	  glBindBufferARB(GL_ARRAY_BUFFER_ARB, inContext->atlas.bufferObjectID);
@@ -553,6 +528,39 @@ static void __glcRenderCountedString(__GLCcontext* inContext,
       if(!node || (i == inCount-1)) {
 	glScalef(resolution, resolution, 1.f);
 
+	if ((inContext->renderState.renderStyle == GLC_TEXTURE)
+	    && GLEW_ARB_vertex_buffer_object) {
+	  /* The quads of the glyphs are gathered with their positions already
+	   * offset by the advances and the kerning. Then the whole run of
+	   * characters is rendered with a single draw call.
+	   */
+	  GLfloat pen[2] = {0.f, 0.f};
+
+	  for (j = 0; j < length; j++) {
+	    if (inIsRightToLeft) {
+	      pen[0] -= chars[j].advance[0];
+	      pen[1] += chars[j].advance[1];
+	    }
+	    /* If the quad can not be stored in the batch, render it on its
+	     * own.
+	     */
+	    if ((chars[j].code != 32)
+		&& !__glcTextureAtlasBatchGlyph(inContext,
+						chars[j].glyph->textureObject,
+						pen))
+	      __glcTextureAtlasDrawGlyph(inContext,
+					 chars[j].glyph->textureObject, pen);
+	    if (!inIsRightToLeft) {
+	      pen[0] += chars[j].advance[0];
+	      pen[1] += chars[j].advance[1];
+	    }
+	  }
+
+	  __glcTextureAtlasFlushBatch(inContext);
+	  glTranslatef(pen[0], pen[1], 0.);
+	  length = 0;
+	}
+
 	for (j = 0; j < length; j++) {
 	  if (inIsRightToLeft)
 	    glTranslatef(-chars[j].advance[0], chars[j].advance[1], 0.);
@@ -561,10 +569,8 @@ static void __glcRenderCountedString(__GLCcontext* inContext,
 
 	    switch(inContext->renderState.renderStyle) {
 	    case GLC_TEXTURE:
-	      if (GLEW_ARB_vertex_buffer_object)
-		glDrawArrays(GL_QUADS, glyph->textureObject->position * 4, 4);
-	      else
-		glCallList(glyph->glObject[1]);
+	      /* With VBOs, the textured glyphs have been rendered above */
+	      glCallList(glyph->glObject[1]);
 	      break;
 	    case GLC_LINE:
 	      if (GLEW_ARB_vertex_buffer_object) {
@@ -994,3 +1000,54 @@ void APIENTRY glcRenderParameterfQSO(GLenum inAttrib, GLfloat inVal)
   ctx->renderState.tolerance = inVal;
   return;
 }
+
+
+
+/** \ingroup render
+ *  This command assigns the value \b inVal to the integer variable identified
+ *  by \e inAttrib which must be chosen in the table below.
+ *
+ *  - \b GLC_ATLAS_PAGE_BUDGET_QSO specifies the maximum number of textures
+ *    that the texture atlas can use to store the glyphs rendered with the
+ *    \b GLC_TEXTURE rendering type when \b GLC_GL_OBJECTS is enabled. Once
+ *    the budget is used up, the glyphs that have not been rendered for the
+ *    longer time are removed from the atlas in order to make room for the new
+ *    ones. Lowering the budget does not delete the textures that already
+ *    exist.
+ *
+ *  The command raises \b GLC_PARAMETER_ERROR if \e inVal is lower than 1.
+ *  \param inAttrib A symbolic constant indicating a GLC attribute.
+ *  \param inVal An integer to be used as the new value of the attribute.
+ *  \sa glcGeti() with argument GLC_ATLAS_PAGE_BUDGET_QSO
+ */
+void APIENTRY glcRenderParameteriQSO(GLenum inAttrib, GLint inVal)
+{
+  __GLCcontext *ctx = NULL;
+
+  GLC_INIT_THREAD();
+
+  /* Check if inAttrib has a legal value */
+  switch(inAttrib) {
+  case GLC_ATLAS_PAGE_BUDGET_QSO:
+    break;
+  default:
+    __glcRaiseError(GLC_PARAMETER_ERROR);
+    return;
+  }
+
+  if (inVal < 1) {
+    __glcRaiseError(GLC_PARAMETER_ERROR);
+    return;
+  }
+
+  /* Check if the current thread owns a current state */
+  ctx = GLC_GET_CURRENT_CONTEXT();
+  if (!ctx) {
+    __glcRaiseError(GLC_STATE_ERROR);
+    return;
+  }
+
+  /* Stores the page budget */
+  ctx->renderState.atlasPageBudget = inVal;
+  return;
+}
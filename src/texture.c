@@ -34,196 +34,668 @@
 
 
 
+/* A node of the skyline that bounds the used part of a page of the texture
+ * atlas: it is the horizontal segment of 'width' texels that starts at (x, y).
+ */
+typedef struct __GLCskylineNodeRec {
+  GLint x;
+  GLint y;
+  GLint width;
+} __GLCskylineNode;
+
+
+
+/* Add an area to the list of the released areas of the page 'inPage'. If the
+ * area can not be stored, it is lost until the page is repacked.
+ */
+static void __glcTextureAtlasAddFreeRect(__GLCatlasPage* inPage,
+					 const GLint inX, const GLint inY,
+					 const GLint inWidth,
+					 const GLint inHeight)
+{
+  GLint rect[4];
+
+  if ((inWidth <= 0) || (inHeight <= 0))
+    return;
+
+  rect[0] = inX;
+  rect[1] = inY;
+  rect[2] = inWidth;
+  rect[3] = inHeight;
+
+  if (__glcArrayAppend(inPage->freeRects, rect))
+    inPage->freeArea += inWidth * inHeight;
+}
+
+
+
+/* Empty the packer of a page of the texture atlas: the skyline is put back at
+ * the bottom of the texture and the list of the released areas is cleared.
+ * The page must not contain any glyph.
+ */
+static void __glcTextureAtlasResetPacker(__GLCatlasPage* inPage)
+{
+  __GLCskylineNode node = {0, 0, 0};
+
+  assert(!inPage->count);
+
+  node.width = inPage->width;
+  GLC_ARRAY_LENGTH(inPage->skyline) = 0;
+  __glcArrayAppend(inPage->skyline, &node);
+  GLC_ARRAY_LENGTH(inPage->freeRects) = 0;
+  inPage->freeArea = 0;
+}
+
+
+
 /* This function is called when a glyph is destroyed, the atlas element is then
  * released.
  */
 void __glcReleaseAtlasElement(__GLCatlasElement* This,
 			      __GLCcontext* inContext)
 {
-  FT_ListNode node = (FT_ListNode)This;
+  __GLCatlasPage* page = GLC_ATLAS_PAGE(inContext, This->page);
 
-  /* Put the atlas element at the tail of the list so that its position is used
-   * as soon as possible.
+  /* The texture area and the quad of the VBO are given back to the atlas so
+   * that they can be re-used by other glyphs. Once the last glyph of a page is
+   * released, the whole page is available again.
    */
-  FT_List_Remove(&inContext->atlasList, node);
-  FT_List_Add(&inContext->atlasList, node);
-  This->glyph = NULL; /* The glyph will be destroyed so clear the pointer */
+  if (--page->count)
+    __glcTextureAtlasAddFreeRect(page, This->rect[0], This->rect[1],
+				 This->rect[2], This->rect[3]);
+  else
+    __glcTextureAtlasResetPacker(page);
+  __glcArrayAppend(inContext->atlasFreeQuads, &This->position);
+
+  FT_List_Remove(&inContext->atlasList, (FT_ListNode)This);
+  __glcFree(This);
 }
 
 
 
-/* This function gets some room in the texture atlas for a new glyph 'inGlyph'.
- * Eventually it creates the texture atlas, if it does not exist yet.
+/* Remove the glyph stored in the atlas element 'inAtlasNode' from the texture
+ * atlas.
  */
-static GLboolean __glcTextureAtlasGetPosition(__GLCcontext* inContext,
-					      __GLCglyph* inGlyph)
+static void __glcTextureAtlasEvict(__GLCcontext* inContext,
+				   __GLCatlasElement* inAtlasNode)
 {
-  __GLCatlasElement* atlasNode = NULL;
+  if (inAtlasNode->glyph)
+    __glcGlyphDestroyTexture(inAtlasNode->glyph, inContext);
+  __glcReleaseAtlasElement(inAtlasNode, inContext);
+}
 
-  /* Test if the atlas already exists. If not, create it. */
-  if (!inContext->atlas.id) {
-    int size = 1024; /* Initial try with a 1024x1024 texture */
-    int i = 0;
-    GLint format = 0;
-    GLint level = 0;
-    void * buffer = NULL;
-
-    /* Not all gfx card are able to use 1024x1024 textures (especially old ones
-     * like 3dfx's). Moreover, the texture memory may be scarce when our texture
-     * will be created, so we try several texture sizes: first 1024x1024 then
-     * if it fails, we try 512x512 then 256x256. All gfx cards support 256x256
-     * textures so if it fails with this texture size, that is because we ran
-     * out of texture memory. In such a case, there is nothing we can do, so the
-     * routine aborts with GLC_RESOURCE_ERROR raised.
-     */
-    for (i = 0; i < 3; i++) {
-      glTexImage2D(GL_PROXY_TEXTURE_2D, 0, GL_ALPHA8, size,
-		   size, 0, GL_ALPHA, GL_UNSIGNED_BYTE, NULL);
-      glGetTexLevelParameteriv(GL_PROXY_TEXTURE_2D, 0, GL_TEXTURE_COMPONENTS,
-			       &format);
-      if (format)
-        break;
-
-      size >>= 1;
+
+
+/* Look for the smallest released area of the page 'inPage' where a rectangle
+ * of inWidth x inHeight texels can be stored. The room that remains in the
+ * area is split in two smaller areas which are kept for later use.
+ */
+static GLboolean __glcTextureAtlasFindFreeRect(__GLCatlasPage* inPage,
+					       const GLint inWidth,
+					       const GLint inHeight,
+					       GLint* outRect)
+{
+  GLint (*freeRects)[4] = (GLint(*)[4])GLC_ARRAY_DATA(inPage->freeRects);
+  GLint best = -1;
+  GLint bestArea = 0;
+  GLint rect[4];
+  int i = 0;
+
+  for (i = 0; i < GLC_ARRAY_LENGTH(inPage->freeRects); i++) {
+    GLint area = freeRects[i][2] * freeRects[i][3];
+
+    if ((freeRects[i][2] < inWidth) || (freeRects[i][3] < inHeight))
+      continue;
+
+    if ((best < 0) || (area < bestArea)) {
+      best = i;
+      bestArea = area;
     }
+  }
 
-    /* Out of texture memory: abort */
-    if (i == 3) {
-      __glcRaiseError(GLC_RESOURCE_ERROR);
+  if (best < 0)
+    return GL_FALSE;
+
+  memcpy(rect, freeRects[best], 4 * sizeof(GLint));
+  __glcArrayRemove(inPage->freeRects, best);
+  inPage->freeArea -= bestArea;
+
+  outRect[0] = rect[0];
+  outRect[1] = rect[1];
+  outRect[2] = inWidth;
+  outRect[3] = inHeight;
+
+  /* Split the remaining room along the shortest side of the glyph so that the
+   * biggest of the two new areas is as large as possible.
+   */
+  if (rect[2] - inWidth > rect[3] - inHeight) {
+    __glcTextureAtlasAddFreeRect(inPage, rect[0] + inWidth, rect[1],
+				 rect[2] - inWidth, rect[3]);
+    __glcTextureAtlasAddFreeRect(inPage, rect[0], rect[1] + inHeight,
+				 inWidth, rect[3] - inHeight);
+  }
+  else {
+    __glcTextureAtlasAddFreeRect(inPage, rect[0] + inWidth, rect[1],
+				 rect[2] - inWidth, inHeight);
+    __glcTextureAtlasAddFreeRect(inPage, rect[0], rect[1] + inHeight,
+				 rect[2], rect[3] - inHeight);
+  }
+
+  return GL_TRUE;
+}
+
+
+
+/* Check if a rectangle of inWidth x inHeight texels can be put on the skyline
+ * of 'inPage' starting at the node 'inIndex'. If it can, the function returns
+ * GL_TRUE and 'outY' contains the ordinate where the rectangle would be
+ * stored.
+ */
+static GLboolean __glcSkylineFit(const __GLCatlasPage* inPage,
+				 const int inIndex, const GLint inWidth,
+				 const GLint inHeight, GLint* outY)
+{
+  __GLCskylineNode* nodes =
+    (__GLCskylineNode*)GLC_ARRAY_DATA(inPage->skyline);
+  GLint widthLeft = inWidth;
+  GLint y = nodes[inIndex].y;
+  int i = inIndex;
+
+  if (nodes[inIndex].x + inWidth > inPage->width)
+    return GL_FALSE;
+
+  while (widthLeft > 0) {
+    if (nodes[i].y > y)
+      y = nodes[i].y;
+    if (y + inHeight > inPage->height)
       return GL_FALSE;
+    widthLeft -= nodes[i].width;
+    i++;
+  }
+
+  *outY = y;
+  return GL_TRUE;
+}
+
+
+
+/* Store a rectangle of inWidth x inHeight texels on top of the skyline of
+ * 'inPage'. The location where the rectangle ends up the lowest is chosen
+ * ("bottom-left" heuristic). The function returns GL_FALSE if the rectangle
+ * does not fit in the room that is left above the skyline.
+ */
+static GLboolean __glcTextureAtlasSkylineAlloc(__GLCatlasPage* inPage,
+					       const GLint inWidth,
+					       const GLint inHeight,
+					       GLint* outRect)
+{
+  __GLCskylineNode* nodes =
+    (__GLCskylineNode*)GLC_ARRAY_DATA(inPage->skyline);
+  __GLCskylineNode newNode = {0, 0, 0};
+  int best = -1;
+  GLint bestTop = 0;
+  GLint bestWidth = 0;
+  GLint y = 0;
+  int i = 0;
+
+  for (i = 0; i < GLC_ARRAY_LENGTH(inPage->skyline); i++) {
+    if (!__glcSkylineFit(inPage, i, inWidth, inHeight, &y))
+      continue;
+
+    if ((best < 0) || (y + inHeight < bestTop)
+	|| ((y + inHeight == bestTop) && (nodes[i].width < bestWidth))) {
+      best = i;
+      bestTop = y + inHeight;
+      bestWidth = nodes[i].width;
+    }
+  }
+
+  if (best < 0)
+    return GL_FALSE;
+
+  newNode.x = nodes[best].x;
+  newNode.y = bestTop;
+  newNode.width = inWidth;
+  if (!__glcArrayInsert(inPage->skyline, best, &newNode))
+    return GL_FALSE;
+
+  outRect[0] = newNode.x;
+  outRect[1] = bestTop - inHeight;
+  outRect[2] = inWidth;
+  outRect[3] = inHeight;
+
+  /* Shrink or remove the nodes that are now below the new node */
+  nodes = (__GLCskylineNode*)GLC_ARRAY_DATA(inPage->skyline);
+  i = best + 1;
+  while (i < GLC_ARRAY_LENGTH(inPage->skyline)) {
+    GLint shrink = nodes[i-1].x + nodes[i-1].width - nodes[i].x;
+
+    if (shrink <= 0)
+      break;
+
+    if (nodes[i].width > shrink) {
+      nodes[i].x += shrink;
+      nodes[i].width -= shrink;
+      break;
     }
 
-    buffer = __glcMalloc(size * size);
-    if (!buffer) {
+    __glcArrayRemove(inPage->skyline, i);
+  }
+
+  /* Merge the neighbour nodes that are at the same height */
+  i = 0;
+  while (i < GLC_ARRAY_LENGTH(inPage->skyline) - 1) {
+    if (nodes[i].y == nodes[i+1].y) {
+      nodes[i].width += nodes[i+1].width;
+      __glcArrayRemove(inPage->skyline, i + 1);
+    }
+    else
+      i++;
+  }
+
+  return GL_TRUE;
+}
+
+
+
+/* Get an unused quad in the copy of the VBO content. If all the quads are used
+ * then the number of quads is doubled. The function returns the index of the
+ * quad or -1 if it fails.
+ */
+static GLint __glcTextureAtlasGetQuad(__GLCcontext* inContext)
+{
+  GLfloat quad[20];
+  GLint length = GLC_ARRAY_LENGTH(inContext->atlasVertices);
+  GLint count = 0;
+  GLint i = 0;
+
+  if (!GLC_ARRAY_LENGTH(inContext->atlasFreeQuads)) {
+    count = length ? length : 256;
+
+    /* Make room for the new quads in both arrays before modifying any of
+     * them so that an unused quad always has its vertices in the copy of the
+     * VBO content.
+     */
+    if (!__glcArrayReserve(inContext->atlasVertices, length + count)
+	|| !__glcArrayReserve(inContext->atlasFreeQuads, count))
+      return -1;
+
+    memset(quad, 0, 20 * sizeof(GLfloat));
+    for (i = 0; i < count; i++)
+      __glcArrayAppend(inContext->atlasVertices, quad);
+
+    /* The new quads are stored in reverse order in the list of unused quads so
+     * that the lowest indices are used first.
+     */
+    for (i = length + count - 1; i >= length; i--)
+      __glcArrayAppend(inContext->atlasFreeQuads, &i);
+  }
+
+  return ((GLint*)GLC_ARRAY_DATA(inContext->atlasFreeQuads))
+    [--GLC_ARRAY_LENGTH(inContext->atlasFreeQuads)];
+}
+
+
+
+/* This function releases the memory used by the packers of the pages of the
+ * texture atlas. The textures themselves are not deleted since the GL context
+ * where they have been created may no longer be current.
+ */
+void __glcTextureAtlasDestroyPages(__GLCcontext* inContext)
+{
+  int i = 0;
+
+  if (!inContext->atlasPages)
+    return;
+
+  for (i = 0; i < GLC_ARRAY_LENGTH(inContext->atlasPages); i++) {
+    __GLCatlasPage* page = GLC_ATLAS_PAGE(inContext, i);
+
+    __glcArrayDestroy(page->skyline);
+    __glcArrayDestroy(page->freeRects);
+    __glcArrayDestroy(page->batch);
+  }
+
+  __glcArrayDestroy(inContext->atlasPages);
+  inContext->atlasPages = NULL;
+}
+
+
+
+/* Get the size of the largest square texture that can be created for the
+ * texture atlas or for the texture cache of the immediate mode.
+ * Not all gfx card are able to use 1024x1024 textures (especially old ones
+ * like 3dfx's). Moreover, the texture memory may be scarce when our texture
+ * will be created, so we try several texture sizes: first 1024x1024 then if it
+ * fails, we try 512x512 then 256x256. All gfx cards support 256x256 textures so
+ * if it fails with this texture size, that is because we ran out of texture
+ * memory. In such a case, the function returns 0.
+ */
+static GLint __glcTextureGetSize(void)
+{
+  GLint size = 1024; /* Initial try with a 1024x1024 texture */
+  GLint format = 0;
+  int i = 0;
+
+  for (i = 0; i < 3; i++) {
+    glTexImage2D(GL_PROXY_TEXTURE_2D, 0, GL_ALPHA8, size,
+		 size, 0, GL_ALPHA, GL_UNSIGNED_BYTE, NULL);
+    glGetTexLevelParameteriv(GL_PROXY_TEXTURE_2D, 0, GL_TEXTURE_COMPONENTS,
+			     &format);
+    if (format)
+      return size;
+
+    size >>= 1;
+  }
+
+  return 0;
+}
+
+
+
+/* This function adds a new page to the texture atlas. The size of the pages is
+ * determined when the first page is created, the next pages have the same
+ * size. The function returns GL_FALSE if the page can not be created : when
+ * this happens for the first page, GLC_RESOURCE_ERROR is raised, otherwise the
+ * caller is expected to make some room in the existing pages.
+ */
+static GLboolean __glcTextureAtlasCreatePage(__GLCcontext* inContext)
+{
+  GLint size = 0;
+  GLint format = 0;
+  GLint level = 0;
+  void * buffer = NULL;
+  __GLCatlasPage page;
+
+  if (GLC_ARRAY_LENGTH(inContext->atlasPages)) {
+    /* Check that there is enough texture memory left for a new page */
+    size = inContext->atlas.width;
+    glTexImage2D(GL_PROXY_TEXTURE_2D, 0, GL_ALPHA8, size,
+		 size, 0, GL_ALPHA, GL_UNSIGNED_BYTE, NULL);
+    glGetTexLevelParameteriv(GL_PROXY_TEXTURE_2D, 0, GL_TEXTURE_COMPONENTS,
+			     &format);
+    if (!format)
+      return GL_FALSE;
+  }
+  else {
+    size = __glcTextureGetSize();
+
+    /* Out of texture memory: there is nothing we can do, so the routine aborts
+     * with GLC_RESOURCE_ERROR raised.
+     */
+    if (!size) {
       __glcRaiseError(GLC_RESOURCE_ERROR);
       return GL_FALSE;
     }
-    memset(buffer, 0, size * size);
 
-    /* Create the texture atlas structure. The texture is divided in small
-     * square areas of GLC_TEXTURE_SIZE x GLC_TEXTURE_SIZE, each of which will
-     * contain a different glyph.
-     * TODO: Allow the user to change GLC_TEXTURE_SIZE rather than using a fixed
-     * value.
+    /* Create the copy of the VBO content. The vertices of the glyphs quads
+     * are kept in memory so that the VBO can be updated one glyph at a time
+     * and so that the strings can be batched without reading back the VBO.
      */
-    glGenTextures(1, &inContext->atlas.id);
+    if (!inContext->atlasVertices) {
+      inContext->atlasVertices = __glcArrayCreate(20 * sizeof(GLfloat));
+      if (!inContext->atlasVertices) {
+	__glcRaiseError(GLC_RESOURCE_ERROR);
+	return GL_FALSE;
+      }
+    }
+    if (!inContext->atlasFreeQuads) {
+      inContext->atlasFreeQuads = __glcArrayCreate(sizeof(GLint));
+      if (!inContext->atlasFreeQuads) {
+	__glcRaiseError(GLC_RESOURCE_ERROR);
+	return GL_FALSE;
+      }
+    }
+
     inContext->atlas.width = size;
     inContext->atlas.height = size;
-    inContext->atlasWidth = size / GLC_TEXTURE_SIZE;
-    inContext->atlasHeight = size / GLC_TEXTURE_SIZE;
-    inContext->atlasCount = 0;
-    glBindTexture(GL_TEXTURE_2D, inContext->atlas.id);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA8, size,
+  }
+
+  /* Create the packer of the page and the batch where the quads of its glyphs
+   * are collected when a string is rendered.
+   */
+  memset(&page, 0, sizeof(__GLCatlasPage));
+  page.width = size;
+  page.height = size;
+  page.skyline = __glcArrayCreate(sizeof(__GLCskylineNode));
+  page.freeRects = __glcArrayCreate(4 * sizeof(GLint));
+  page.batch = __glcArrayCreate(20 * sizeof(GLfloat));
+  buffer = __glcMalloc(size * size);
+  if (!page.skyline || !page.freeRects || !page.batch || !buffer
+      || !__glcArrayAppend(inContext->atlasPages, &page)) {
+    if (page.skyline)
+      __glcArrayDestroy(page.skyline);
+    if (page.freeRects)
+      __glcArrayDestroy(page.freeRects);
+    if (page.batch)
+      __glcArrayDestroy(page.batch);
+    if (buffer)
+      __glcFree(buffer);
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    return GL_FALSE;
+  }
+  memset(buffer, 0, size * size);
+
+  /* Create the texture of the page. The glyphs are packed in the texture in
+   * rectangles that are sized to their bounding box.
+   */
+  glGenTextures(1, &page.id);
+  GLC_ATLAS_PAGE(inContext, GLC_ARRAY_LENGTH(inContext->atlasPages) - 1)->id =
+    page.id;
+  glBindTexture(GL_TEXTURE_2D, page.id);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA8, size,
+	       size, 0, GL_ALPHA, GL_UNSIGNED_BYTE, buffer);
+
+  /* Create the mipmap structure of the texture, no matter if GLC_MIPMAP is
+   * enabled or not.
+   */
+  while (size > 1) {
+    size >>= 1;
+    level++;
+    glTexImage2D(GL_TEXTURE_2D, level, GL_ALPHA8, size,
 		 size, 0, GL_ALPHA, GL_UNSIGNED_BYTE, buffer);
+  }
 
-    /* Create the mipmap structure of the texture atlas, no matter if GLC_MIPMAP
-     * is enabled or not.
-     */
-    while (size > 1) {
-      size >>= 1;
-      level++;
-      glTexImage2D(GL_TEXTURE_2D, level, GL_ALPHA8, size,
-		   size, 0, GL_ALPHA, GL_UNSIGNED_BYTE, buffer);
-    }
+  /* Use trilinear filtering if GLC_MIPMAP is enabled.
+   * Otherwise use bilinear filtering.
+   */
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+		  GL_LINEAR_MIPMAP_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
 
-    /* Use trilinear filtering if GLC_MIPMAP is enabled.
-     * Otherwise use bilinear filtering.
-     */
+  /* The intent of this code is to work around an ugly bug of the Intel GMA
+   * 965 (or X3000) drivers on Linux. On those crappy drivers a 2nd call to
+   * glTexSubImage2D() completely clears the texture removing by the way the
+   * first character stored in the texture...
+   * This workaround displays a dummy character in order to deceive the
+   * stupid drivers. Note that I tried to reduce the code to the minimum: it
+   * seems that if any line below is removed, the workaround no longer works
+   * around the f***ing bug.
+   */
+  size = GLC_TEXTURE_SIZE;
+  glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, size, size, GL_ALPHA,
+		  GL_UNSIGNED_BYTE, buffer);
+  level = 0;
+  while (size > 2) {
+    size >>= 1;
+    level++;
+    glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, size, size, GL_ALPHA,
+		    GL_UNSIGNED_BYTE, buffer);
+  }
+
+  /* The mipmap levels of the glyphs are only built down to
+   * GLC_ATLAS_MAX_LEVEL.
+   */
+  if (GLEW_VERSION_1_2 || GLEW_SGIS_texture_lod)
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, GLC_ATLAS_MAX_LEVEL);
+
+  glBegin(GL_QUADS);
+  glNormal3f(0.f, 0.f, 1.f);
+  glTexCoord2f(0.f, 0.f);
+  glVertex2f(0.f, 0.f);
+  glTexCoord2f(0.f, 1.f);
+  glVertex2f(0.f, .5f);
+  glTexCoord2f(1.f, 1.f);
+  glVertex2f(.5f, .5f);
+  glTexCoord2f(1.f, 0.f);
+  glVertex2f(.5f, 0.f);
+  glEnd();
+  /* End of the workaround for the crappy open source drivers for Intel chips
+   */
+  __glcFree(buffer);
+
+  if (inContext->enableState.mipmap)
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
 		    GL_LINEAR_MIPMAP_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
-
-    /* The intent of this code is to work around an ugly bug of the Intel GMA
-     * 965 (or X3000) drivers on Linux. On those crappy drivers a 2nd call to
-     * glTexSubImage2D() completely clears the texture removing by the way the
-     * first character stored in the texture...
-     * This workaround displays a dummy character in order to deceive the
-     * stupid drivers. Note that I tried to reduce the code to the minimum: it
-     * seems that if any line below is removed, the workaround no longer works
-     * around the f***ing bug.
-     */
-    size = GLC_TEXTURE_SIZE;
-    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, size, size, GL_ALPHA,
-		    GL_UNSIGNED_BYTE, buffer);
-    level = 0;
-    while (size > 2) {
-      size >>= 1;
-      level++;
-      glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, size, size, GL_ALPHA,
-		      GL_UNSIGNED_BYTE, buffer);
-    }
+  else
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+		    GL_LINEAR);
 
-    if (GLEW_VERSION_1_2 || GLEW_SGIS_texture_lod)
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level - 1);
-
-    glBegin(GL_QUADS);
-    glNormal3f(0.f, 0.f, 1.f);
-    glTexCoord2f(0.f, 0.f);
-    glVertex2f(0.f, 0.f);
-    glTexCoord2f(0.f, 1.f);
-    glVertex2f(0.f, .5f);
-    glTexCoord2f(1.f, 1.f);
-    glVertex2f(.5f, .5f);
-    glTexCoord2f(1.f, 0.f);
-    glVertex2f(.5f, 0.f);
-    glEnd();
-    /* End of the workaround for the crappy open source drivers for Intel chips
-     */
-    __glcFree(buffer);
+  __glcTextureAtlasResetPacker(GLC_ATLAS_PAGE(inContext,
+			GLC_ARRAY_LENGTH(inContext->atlasPages) - 1));
 
-    if (inContext->enableState.mipmap)
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
-		      GL_LINEAR_MIPMAP_LINEAR);
-    else
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
-		      GL_LINEAR);
+  return GL_TRUE;
+}
+
+
+
+/* Look for some room in the existing pages of the texture atlas where a glyph
+ * which bitmap is inWidth x inHeight texels large can be stored. The areas that
+ * have been released by other glyphs are looked up first, then the room above
+ * the skyline is used. The function returns the index of the page or -1 if the
+ * glyph does not fit in any page.
+ */
+static int __glcTextureAtlasFindRoom(__GLCcontext* inContext,
+				     const GLint inWidth, const GLint inHeight,
+				     GLint* outRect)
+{
+  int i = 0;
+
+  for (i = 0; i < GLC_ARRAY_LENGTH(inContext->atlasPages); i++) {
+    __GLCatlasPage* page = GLC_ATLAS_PAGE(inContext, i);
+
+    if (__glcTextureAtlasFindFreeRect(page, inWidth, inHeight, outRect)
+	|| __glcTextureAtlasSkylineAlloc(page, inWidth, inHeight, outRect))
+      return i;
+  }
+
+  return -1;
+}
+
+
+
+/* This function gets some room in the texture atlas for a new glyph 'inGlyph'
+ * which bitmap is inWidth x inHeight texels large. The texture of the page
+ * where the glyph is stored is bound to GL_TEXTURE_2D.
+ * Eventually it creates the texture atlas, if it does not exist yet.
+ */
+static GLboolean __glcTextureAtlasGetPosition(__GLCcontext* inContext,
+					      __GLCglyph* inGlyph,
+					      const GLint inWidth,
+					      const GLint inHeight)
+{
+  __GLCatlasElement* atlasNode = NULL;
+  __GLCatlasPage* page = NULL;
+  GLint rect[4] = {0, 0, 0, 0};
+  GLint position = 0;
+  int pageIndex = 0;
+
+  /* Test if the atlas already exists. If not, create its first page. */
+  if (!GLC_ARRAY_LENGTH(inContext->atlasPages)) {
+    if (!__glcTextureAtlasCreatePage(inContext))
+      return GL_FALSE;
+  }
+
+  /* The glyph is too large for the texture */
+  if ((inWidth > inContext->atlas.width)
+      || (inHeight > inContext->atlas.height)) {
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    return GL_FALSE;
   }
 
   /* At this stage, we want to get a free area in the texture atlas in order to
-   * store a new glyph. Two situations may occur: the atlas is full or not
+   * store the new glyph.
    */
-  if (inContext->atlasCount == inContext->atlasWidth * inContext->atlasHeight) {
-    /* The texture atlas is full. We must release an area to re-use it.
-     * We get the glyph that has not been used for the longer time (that is the
-     * tail element of atlasList).
-     */
-    atlasNode = (__GLCatlasElement*)inContext->atlasList.tail;
-    assert(atlasNode);
+  while ((pageIndex = __glcTextureAtlasFindRoom(inContext, inWidth, inHeight,
+						rect)) < 0) {
+    __GLCatlasElement* tail = (__GLCatlasElement*)inContext->atlasList.tail;
 
-    if (atlasNode->glyph) {
-      /* Release the texture area of the glyph */
-      __glcGlyphDestroyTexture(atlasNode->glyph, inContext);
-    }
-    /* Put the texture area at the head of the list otherwise we will use the
-     * same texture element over and over again each time that we need to
-     * release a texture area.
-     */
-    FT_List_Up(&inContext->atlasList, (FT_ListNode)atlasNode);
-  }
-  else {
-    /* The texture atlas is not full. We create a new texture area and we store
-     * its definition in atlas list.
+    /* The glyph does not fit in the texture atlas. As long as the page budget
+     * is not used up, a new page is added to the atlas.
      */
-    atlasNode = (__GLCatlasElement*)__glcMalloc(sizeof(__GLCatlasElement));
-    if (!atlasNode) {
+    if ((GLC_ARRAY_LENGTH(inContext->atlasPages)
+	 < inContext->renderState.atlasPageBudget)
+	&& __glcTextureAtlasCreatePage(inContext))
+      continue;
+
+    if (!tail) {
+      /* The atlas is empty and the glyph still does not fit */
       __glcRaiseError(GLC_RESOURCE_ERROR);
       return GL_FALSE;
     }
 
-    atlasNode->node.data = atlasNode;
-    atlasNode->position = inContext->atlasCount++;
-    FT_List_Insert(&inContext->atlasList, (FT_ListNode)atlasNode);
+    page = GLC_ATLAS_PAGE(inContext, tail->page);
+    if (page->freeArea >= GLC_ATLAS_REPACK_RATIO
+	* inContext->atlas.width * inContext->atlas.height) {
+      /* The page of the glyph that has not been used for the longer time is
+       * too fragmented: all its glyphs are released and its packer starts
+       * from scratch. The glyphs that are still in use will be packed again
+       * the next time they are rendered.
+       */
+      FT_ListNode node = inContext->atlasList.head;
+
+      pageIndex = tail->page;
+      while (node) {
+	FT_ListNode next = node->next;
+
+	if (((__GLCatlasElement*)node)->page == pageIndex)
+	  __glcTextureAtlasEvict(inContext, (__GLCatlasElement*)node);
+	node = next;
+      }
+    }
+    else {
+      /* We release the area of the glyph that has not been used for the
+       * longer time (that is the tail element of atlasList).
+       */
+      __glcTextureAtlasEvict(inContext, tail);
+    }
+  }
+
+  page = GLC_ATLAS_PAGE(inContext, pageIndex);
+
+  position = __glcTextureAtlasGetQuad(inContext);
+  if (position < 0) {
+    __glcTextureAtlasAddFreeRect(page, rect[0], rect[1], rect[2], rect[3]);
+    return GL_FALSE;
+  }
+
+  atlasNode = (__GLCatlasElement*)__glcMalloc(sizeof(__GLCatlasElement));
+  if (!atlasNode) {
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    __glcTextureAtlasAddFreeRect(page, rect[0], rect[1], rect[2], rect[3]);
+    __glcArrayAppend(inContext->atlasFreeQuads, &position);
+    return GL_FALSE;
   }
 
   /* Update the texture element */
+  atlasNode->node.data = atlasNode;
+  atlasNode->page = pageIndex;
+  atlasNode->position = position;
+  memcpy(atlasNode->rect, rect, 4 * sizeof(GLint));
   atlasNode->glyph = inGlyph;
   inGlyph->textureObject = atlasNode;
+  FT_List_Insert(&inContext->atlasList, (FT_ListNode)atlasNode);
+  page->count++;
+
+  glBindTexture(GL_TEXTURE_2D, page->id);
 
   if (GLEW_ARB_vertex_buffer_object) {
     /* Create a VBO, if none exists yet */
     if (!inContext->atlas.bufferObjectID) {
+      const GLubyte* renderer = glGetString(GL_RENDERER);
+
       glGenBuffersARB(1, &inContext->atlas.bufferObjectID);
       if (!inContext->atlas.bufferObjectID) {
 	__glcRaiseError(GLC_RESOURCE_ERROR);
@@ -232,9 +704,34 @@ static GLboolean __glcTextureAtlasGetPosition(__GLCcontext* inContext,
 	 */
 	return GL_TRUE;
       }
+
+      /* The GL command glBufferSubData() seems to be buggy on some GL drivers
+       * (the DRI Intel specifically). On those drivers the whole content of
+       * the VBO is uploaded each time a glyph is added to the atlas.
+       */
+      inContext->atlasSubData = !(renderer
+				  && strstr((const char*)renderer,
+					    "Mesa DRI Intel"));
+      inContext->atlasBufferSize = 0;
     }
-    /* Bind the buffer and define/update its size */
+
     glBindBufferARB(GL_ARRAY_BUFFER_ARB, inContext->atlas.bufferObjectID);
+
+    /* Size of the buffer data is equal to the number of quads of the copy of
+     * the VBO content times 20 GLfloat (4 vertices made of 3D coordinates plus
+     * 2D texture coordinates: 4 * (3 + 2) = 20).
+     * The VBO is initialized with its copy whenever it is created or its size
+     * changes: the VBO may have been deleted by glcDeleteGLObjects() while the
+     * texture atlas was kept.
+     */
+    if (inContext->atlasBufferSize
+	!= GLC_ARRAY_LENGTH(inContext->atlasVertices)) {
+      glBufferDataARB(GL_ARRAY_BUFFER_ARB,
+		      GLC_ARRAY_SIZE(inContext->atlasVertices),
+		      GLC_ARRAY_DATA(inContext->atlasVertices),
+		      GL_STATIC_DRAW_ARB);
+      inContext->atlasBufferSize = GLC_ARRAY_LENGTH(inContext->atlasVertices);
+    }
   }
 
   return GL_TRUE;
@@ -242,6 +739,20 @@ static GLboolean __glcTextureAtlasGetPosition(__GLCcontext* inContext,
 
 
 
+/* Compute the lower power of 2 that is greater than value. It is used to
+ * determine the smaller texture than can contain a glyph.
+ */
+static int __glcNextPowerOf2(int value)
+{
+  int power = 0;
+
+  for (power = 1; power < value; power <<= 1);
+
+  return power;
+}
+
+
+
 /* For immediate rendering mode (that is when GLC_GL_OBJECTS is disabled), this
  * function returns a texture that will store the glyph that is intended to be
  * rendered. If the texture does not exist yet, it is created.
@@ -270,13 +781,18 @@ static GLboolean __glcTextureGetImmediate(__GLCcontext* inContext,
       inContext->texture.height = 0;
     }
     else {
-      /* The texture is large enough, it is already bound to the current
-       * GL context.
+      /* The texture is large enough, it just needs to be bound since the
+       * texture cache may have been used since the last glyph.
        */
+      glBindTexture(GL_TEXTURE_2D, inContext->texture.id);
       return GL_TRUE;
     }
   }
 
+  /* The size of the texture must be a power of 2 */
+  width = __glcNextPowerOf2(width);
+  height = __glcNextPowerOf2(height);
+
   if (GLEW_ARB_pixel_buffer_object)
     glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, 0);
 
@@ -334,6 +850,298 @@ static GLboolean __glcTextureGetImmediate(__GLCcontext* inContext,
 
 
 
+/* Create the texture cache of the immediate mode. Its texture has the same
+ * size than the pages of the texture atlas would have. The function returns
+ * GL_FALSE if the cache can not be created : the glyphs are then rendered in
+ * the texture of the immediate mode, one at a time.
+ * The texels that are not covered by any glyph must be transparent since they
+ * are read by the bilinear filtering of their neighbours, so the texture is
+ * initialized with a blank image.
+ */
+static GLboolean __glcTextureCacheCreate(__GLCcontext* inContext)
+{
+  GLint size = __glcTextureGetSize();
+  __GLCatlasPage* page = NULL;
+  void* buffer = NULL;
+
+  if (!size)
+    return GL_FALSE;
+
+  page = (__GLCatlasPage*)__glcMalloc(sizeof(__GLCatlasPage));
+  if (!page) {
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    return GL_FALSE;
+  }
+
+  memset(page, 0, sizeof(__GLCatlasPage));
+  page->width = size;
+  page->height = size;
+  page->skyline = __glcArrayCreate(sizeof(__GLCskylineNode));
+  page->freeRects = __glcArrayCreate(4 * sizeof(GLint));
+  buffer = __glcMalloc(size * size);
+  if (!page->skyline || !page->freeRects || !buffer) {
+    if (page->skyline)
+      __glcArrayDestroy(page->skyline);
+    if (page->freeRects)
+      __glcArrayDestroy(page->freeRects);
+    if (buffer)
+      __glcFree(buffer);
+    __glcFree(page);
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    return GL_FALSE;
+  }
+  memset(buffer, 0, size * size);
+
+  /* For immediate mode rendering, always use bilinear filtering (see
+   * __glcTextureGetImmediate()).
+   */
+  glGenTextures(1, &page->id);
+  glBindTexture(GL_TEXTURE_2D, page->id);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA8, size, size, 0, GL_ALPHA,
+	       GL_UNSIGNED_BYTE, buffer);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+  __glcFree(buffer);
+
+  __glcTextureAtlasResetPacker(page);
+  inContext->textureCache = page;
+
+  return GL_TRUE;
+}
+
+
+
+/* This function is called when a glyph is destroyed or when its image is
+ * evicted from the texture cache of the immediate mode. The area of the image
+ * is given back to the cache.
+ */
+void __glcReleaseTextureCacheElement(__GLCtextureCacheElement* This,
+				     __GLCcontext* inContext)
+{
+  __GLCatlasPage* page = inContext->textureCache;
+  __GLCtextureCacheElement** link = &This->glyph->textureCacheObject;
+
+  while (*link != This)
+    link = &(*link)->next;
+  *link = This->next;
+
+  if (--page->count)
+    __glcTextureAtlasAddFreeRect(page, This->rect[0], This->rect[1],
+				 This->rect[2], This->rect[3]);
+  else
+    __glcTextureAtlasResetPacker(page);
+
+  FT_List_Remove(&inContext->textureCacheList, (FT_ListNode)This);
+  __glcFree(This);
+}
+
+
+
+/* This function empties the texture cache of the immediate mode and releases
+ * the memory of its packer. The texture itself is not deleted since the GL
+ * context where it has been created may no longer be current.
+ */
+void __glcTextureCacheDestroy(__GLCcontext* inContext)
+{
+  if (!inContext->textureCache)
+    return;
+
+  while (inContext->textureCacheList.head)
+    __glcReleaseTextureCacheElement(
+	    (__GLCtextureCacheElement*)inContext->textureCacheList.head,
+	    inContext);
+
+  __glcArrayDestroy(inContext->textureCache->skyline);
+  __glcArrayDestroy(inContext->textureCache->freeRects);
+  __glcFree(inContext->textureCache);
+  inContext->textureCache = NULL;
+}
+
+
+
+/* This function rasterizes the glyph 'inGlyph' and stores its image in the
+ * texture cache of the immediate mode with the key 'inKey'. The glyph must
+ * have been loaded in the face of 'inFont'. If the cache is full, the least
+ * recently used images are evicted. The function returns NULL if the image
+ * can not be stored in the cache.
+ * The pixel store parameters and the PBO binding must be set by the caller.
+ */
+static __GLCtextureCacheElement*
+__glcTextureCacheAdd(const __GLCfont* inFont, __GLCcontext* inContext,
+		     const GLfloat inScaleX, const GLfloat inScaleY,
+		     __GLCglyph* inGlyph, const __GLCtextureCacheElement* inKey)
+{
+  __GLCtextureCacheElement* element = NULL;
+  __GLCatlasPage* page = NULL;
+  GLint width = 0, height = 0;
+  GLint boundingBox[4] = {0, 0, 0, 0};
+  GLint rect[4] = {0, 0, 0, 0};
+  void* buffer = NULL;
+
+  if (!inContext->textureCache && !__glcTextureCacheCreate(inContext))
+    return NULL;
+
+  page = inContext->textureCache;
+
+  if (!__glcFontGetBitmapSize(inFont, &width, &height, inScaleX, inScaleY, 0,
+			      boundingBox, inContext))
+    return NULL;
+
+  /* The large glyphs are not cached: they would evict too many glyphs from
+   * the cache.
+   */
+  if ((width > (page->width >> 2)) || (height > (page->height >> 2)))
+    return NULL;
+
+  while (!__glcTextureAtlasFindFreeRect(page, width, height, rect)
+	 && !__glcTextureAtlasSkylineAlloc(page, width, height, rect)) {
+    if (!inContext->textureCacheList.tail)
+      return NULL;
+
+    if (page->freeArea >= GLC_ATLAS_REPACK_RATIO * page->width * page->height)
+    {
+      /* The cache is too fragmented: all the images are evicted and the packer
+       * starts from scratch.
+       */
+      while (inContext->textureCacheList.head)
+	__glcReleaseTextureCacheElement(
+		(__GLCtextureCacheElement*)inContext->textureCacheList.head,
+		inContext);
+    }
+    else
+      __glcReleaseTextureCacheElement(
+	      (__GLCtextureCacheElement*)inContext->textureCacheList.tail,
+	      inContext);
+  }
+
+  element = (__GLCtextureCacheElement*)
+    __glcMalloc(sizeof(__GLCtextureCacheElement));
+  buffer = __glcMalloc(width * height);
+  if (!element || !buffer) {
+    if (element)
+      __glcFree(element);
+    if (buffer)
+      __glcFree(buffer);
+    __glcTextureAtlasAddFreeRect(page, rect[0], rect[1], rect[2], rect[3]);
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    return NULL;
+  }
+
+  /* render the glyph */
+  if (!__glcFontGetBitmap(inFont, width, height, buffer, inContext)) {
+    __glcFree(element);
+    __glcFree(buffer);
+    __glcTextureAtlasAddFreeRect(page, rect[0], rect[1], rect[2], rect[3]);
+    return NULL;
+  }
+
+  glBindTexture(GL_TEXTURE_2D, page->id);
+  glTexSubImage2D(GL_TEXTURE_2D, 0, rect[0], rect[1], width, height, GL_ALPHA,
+		  GL_UNSIGNED_BYTE, buffer);
+  __glcFree(buffer);
+
+  memcpy(element, inKey, sizeof(__GLCtextureCacheElement));
+  element->node.data = element;
+  element->glyph = inGlyph;
+  memcpy(element->rect, rect, 4 * sizeof(GLint));
+  memcpy(element->boundingBox, boundingBox, 4 * sizeof(GLint));
+  element->next = inGlyph->textureCacheObject;
+  inGlyph->textureCacheObject = element;
+  FT_List_Insert(&inContext->textureCacheList, (FT_ListNode)element);
+  page->count++;
+
+  return element;
+}
+
+
+
+/* This function looks for the image of the glyph 'inGlyph' in the texture
+ * cache of the immediate mode. The images are looked up with the size of the
+ * character quantized the same way than FreeType does, the resolution and the
+ * hinting flag. If the image is not found, it is rasterized and added to the
+ * cache. The texture of the cache is bound to GL_TEXTURE_2D when the function
+ * succeeds. Otherwise it returns NULL and the glyph must be rendered without
+ * the cache.
+ */
+static __GLCtextureCacheElement*
+__glcTextureCacheGetElement(const __GLCfont* inFont, __GLCcontext* inContext,
+			    const GLfloat inScaleX, const GLfloat inScaleY,
+			    __GLCglyph* inGlyph)
+{
+  __GLCtextureCacheElement key;
+  __GLCtextureCacheElement* element = NULL;
+
+  /* See __glcFaceDescPrepareFont() */
+  memset(&key, 0, sizeof(__GLCtextureCacheElement));
+  key.scale[0] = (FT_F26Dot6)(inScaleX * 64.);
+  key.scale[1] = (FT_F26Dot6)(inScaleY * 64.);
+  key.resolution = (GLint)inContext->renderState.resolution;
+  key.hinting = inContext->enableState.hinting;
+
+  for (element = inGlyph->textureCacheObject; element;
+       element = element->next) {
+    if ((element->scale[0] == key.scale[0])
+	&& (element->scale[1] == key.scale[1])
+	&& (element->resolution == key.resolution)
+	&& (element->hinting == key.hinting)) {
+      FT_List_Up(&inContext->textureCacheList, (FT_ListNode)element);
+      glBindTexture(GL_TEXTURE_2D, inContext->textureCache->id);
+      return element;
+    }
+  }
+
+  /* The image is uploaded from the client memory, so the PBO of the immediate
+   * mode is temporarily unbound.
+   */
+  glPushClientAttrib(GL_CLIENT_PIXEL_STORE_BIT);
+  glPixelStorei(GL_UNPACK_LSB_FIRST, GL_FALSE);
+  glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+  glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+  glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  if (GLEW_ARB_pixel_buffer_object)
+    glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, 0);
+
+  element = __glcTextureCacheAdd(inFont, inContext, inScaleX, inScaleY,
+				 inGlyph, &key);
+
+  if (GLEW_ARB_pixel_buffer_object && inContext->texture.bufferObjectID)
+    glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB,
+		    inContext->texture.bufferObjectID);
+  glPopClientAttrib();
+
+  return element;
+}
+
+
+
+/* Render the quad of a glyph which image is stored at (inTexX, inTexY) in a
+ * texture of inTexWidth x inTexHeight texels. The image is inWidth x inHeight
+ * texels large and the glyph bounding box is given by 'inBoundingBox'.
+ */
+static void __glcTextureRenderQuad(const GLint inTexX, const GLint inTexY,
+				   const GLint inWidth, const GLint inHeight,
+				   const GLfloat inTexWidth,
+				   const GLfloat inTexHeight,
+				   const GLint* inBoundingBox)
+{
+  glBegin(GL_QUADS);
+  glTexCoord2f(inTexX / inTexWidth, inTexY / inTexHeight);
+  glVertex2iv(inBoundingBox);
+  glTexCoord2f((inTexX + inWidth - 1) / inTexWidth, inTexY / inTexHeight);
+  glVertex2i(inBoundingBox[2], inBoundingBox[1]);
+  glTexCoord2f((inTexX + inWidth - 1) / inTexWidth,
+	       (inTexY + inHeight - 1) / inTexHeight);
+  glVertex2iv(inBoundingBox + 2);
+  glTexCoord2f(inTexX / inTexWidth, (inTexY + inHeight - 1) / inTexHeight);
+  glVertex2i(inBoundingBox[0], inBoundingBox[3]);
+  glEnd();
+}
+
+
+
 /* Internal function that renders glyph in textures:
  * 'inCode' must be given in UCS-4 format
  */
@@ -346,31 +1154,56 @@ void __glcRenderCharTexture(const __GLCfont* inFont, __GLCcontext* inContext,
   GLint pixWidth = 0, pixHeight = 0;
   void* pixBuffer = NULL;
   GLint pixBoundingBox[4] = {0, 0, 0, 0};
-  int minSize = (GLEW_VERSION_1_2 || GLEW_SGIS_texture_lod) ? 2 : 1;
+  GLint rectWidth = 0, rectHeight = 0;
   GLfloat texWidth = 0.f, texHeight = 0.f;
 
   if (inContext->enableState.glObjects) {
     __GLCatlasElement* atlasNode = NULL;
 
-    if (!__glcTextureAtlasGetPosition(inContext, inGlyph))
+    /* Compute the size of the pixmap where the glyph will be rendered */
+    if (!__glcFontGetBitmapSize(inFont, &pixWidth, &pixHeight, inScaleX,
+				inScaleY, 0, pixBoundingBox, inContext))
       return;
 
-    /* Compute the size of the pixmap where the glyph will be rendered */
-    atlasNode = inGlyph->textureObject;
+    if (!__glcTextureAtlasGetPosition(inContext, inGlyph, pixWidth,
+				      pixHeight))
+      return;
 
-    __glcFontGetBitmapSize(inFont, &pixWidth, &pixHeight, inScaleX, inScaleY, 0,
-			   pixBoundingBox, inContext);
+    atlasNode = inGlyph->textureObject;
 
     texWidth = inContext->atlas.width;
     texHeight = inContext->atlas.height;
-    texY = (atlasNode->position / inContext->atlasWidth);
-    texX = (atlasNode->position - texY*inContext->atlasWidth)*GLC_TEXTURE_SIZE;
-    texY *= GLC_TEXTURE_SIZE;
+    texX = atlasNode->rect[0];
+    texY = atlasNode->rect[1];
   }
   else {
+    __GLCtextureCacheElement* element = __glcTextureCacheGetElement(inFont,
+								     inContext,
+								     inScaleX,
+								     inScaleY,
+								     inGlyph);
     int factor = 0;
 
-    /* Try several texture size until we are able to create one */
+    /* The image of the glyph is stored in the texture cache. The outer texels
+     * of its padding are not covered by the quad so that the bilinear
+     * filtering does not read the texels of the neighbour areas of the cache.
+     */
+    if (element) {
+      pixBoundingBox[0] = element->boundingBox[0] + 64;
+      pixBoundingBox[1] = element->boundingBox[1] + 64;
+      pixBoundingBox[2] = element->boundingBox[2];
+      pixBoundingBox[3] = element->boundingBox[3];
+      __glcTextureRenderQuad(element->rect[0] + 1, element->rect[1] + 1,
+			     element->rect[2] - 1, element->rect[3] - 1,
+			     inContext->textureCache->width,
+			     inContext->textureCache->height,
+			     pixBoundingBox);
+      return;
+    }
+
+    /* Otherwise the glyph is rendered in the texture of the immediate mode.
+     * Try several texture size until we are able to create one.
+     */
     do {
       if (!__glcFontGetBitmapSize(inFont, &pixWidth, &pixHeight, inScaleX,
 				  inScaleY, factor, pixBoundingBox, inContext))
@@ -385,6 +1218,9 @@ void __glcRenderCharTexture(const __GLCfont* inFont, __GLCcontext* inContext,
     texY = 0;
   }
 
+  rectWidth = pixWidth;
+  rectHeight = pixHeight;
+
   if (!inContext->texture.bufferObjectID || inContext->enableState.glObjects) {
     pixBuffer = (GLubyte *)__glcMalloc(pixWidth * pixHeight);
     if (!pixBuffer) {
@@ -443,13 +1279,11 @@ void __glcRenderCharTexture(const __GLCfont* inFont, __GLCcontext* inContext,
     level++; /* Next level of mipmap */
     pixWidth >>= 1;
     pixHeight >>= 1;
-  } while ((pixWidth > minSize) && (pixHeight > minSize));
+  } while (level <= GLC_ATLAS_MAX_LEVEL);
 
   /* Finish to build the mipmap if necessary */
   if (inContext->enableState.mipmap && inContext->enableState.glObjects) {
-    if (GLEW_VERSION_1_2 || GLEW_SGIS_texture_lod)
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level - 1);
-    else {
+    if (!(GLEW_VERSION_1_2 || GLEW_SGIS_texture_lod)) {
       /* The OpenGL driver does not support the extension GL_EXT_texture_lod
        * We must finish the pixmap until the mipmap level is 1x1.
        * Here the smaller mipmap levels will be transparent, no glyph will be
@@ -484,55 +1318,27 @@ void __glcRenderCharTexture(const __GLCfont* inFont, __GLCcontext* inContext,
    */
   if (inContext->enableState.glObjects) {
     if (GLEW_ARB_vertex_buffer_object) {
-      GLfloat* buffer = NULL;
-      GLfloat* data = NULL;
       __GLCatlasElement* atlasNode = inGlyph->textureObject;
-
-      buffer = (GLfloat*)__glcMalloc(inContext->atlasWidth
-				     * inContext->atlasHeight * 20
-				     * sizeof(GLfloat));
-      if (!buffer) {
-	__glcRaiseError(GLC_RESOURCE_ERROR);
-	return;
-      }
+      GLfloat* data = (GLfloat*)GLC_ARRAY_DATA(inContext->atlasVertices)
+	+ atlasNode->position * 20;
 
       /* The display list ID is used as a flag to declare that the VBO has been
        * initialized and can be used.
        */
       inGlyph->glObject[1] = 0xffffffff;
 
-      /* Here we do not use the GL command glBufferSubData() since it seems to
-       * be buggy on some GL drivers (the DRI Intel specifically).
-       * Instead, we use a workaround: the current values of the VBO are stored
-       * in memory and new values are appended to them. Then, the content of
-       * the resulting array replaces all the values previously stored in the
-       * VBO.
-       */
-      if (inContext->atlasCount > 1) {
-	data = (GLfloat*)glMapBufferARB(GL_ARRAY_BUFFER_ARB, GL_READ_ONLY);
-	if (!data) {
-	  __glcRaiseError(GLC_RESOURCE_ERROR);
-	  __glcFree(buffer);
-	  return;
-	}
-	memcpy(buffer, data, inContext->atlasCount * 20 * sizeof(GLfloat));
-	glUnmapBufferARB(GL_ARRAY_BUFFER_ARB);
-      }
-
-      data = buffer + atlasNode->position * 20;
-
       data[0] = texX / texWidth;
       data[1] = texY / texHeight;
       data[2] = pixBoundingBox[0] / 64. / GLC_TEXTURE_SIZE;
       data[3] = pixBoundingBox[1] / 64. / GLC_TEXTURE_SIZE;
       data[4] = 0.f;
-      data[5] = (texX + GLC_TEXTURE_SIZE - 1) / texWidth;
+      data[5] = (texX + rectWidth - 1) / texWidth;
       data[6] = data[1];
       data[7] = pixBoundingBox[2] / 64.	/ GLC_TEXTURE_SIZE;
       data[8] = data[3];
       data[9] = 0.f;
       data[10] = data[5];
-      data[11] = (texY + GLC_TEXTURE_SIZE - 1) / texHeight;
+      data[11] = (texY + rectHeight - 1) / texHeight;
       data[12] = data[7];
       data[13] = pixBoundingBox[3] / 64. / GLC_TEXTURE_SIZE;
       data[14] = 0.f;
@@ -542,15 +1348,19 @@ void __glcRenderCharTexture(const __GLCfont* inFont, __GLCcontext* inContext,
       data[18] = data[13];
       data[19] = 0.f;
 
-      /* Size of the buffer data is equal to the number of glyphs than can be
-       * stored in the texture times 20 GLfloat (4 vertices made of 3D
-       * coordinates plus 2D texture coordinates: 4 * (3 + 2) = 20)
+      /* Only the 20 GLfloat of the new glyph are sent to the VBO. If the GL
+       * driver can not be trusted with glBufferSubData(), the whole copy of
+       * the VBO content replaces all the values previously stored in the VBO.
        */
-      glBufferDataARB(GL_ARRAY_BUFFER_ARB,
-		      inContext->atlasWidth * inContext->atlasHeight
-		      * 20 * sizeof(GLfloat), buffer, GL_STATIC_DRAW_ARB);
-
-      __glcFree(buffer);
+      if (inContext->atlasSubData)
+	glBufferSubDataARB(GL_ARRAY_BUFFER_ARB,
+			   atlasNode->position * 20 * sizeof(GLfloat),
+			   20 * sizeof(GLfloat), data);
+      else
+	glBufferDataARB(GL_ARRAY_BUFFER_ARB,
+			GLC_ARRAY_SIZE(inContext->atlasVertices),
+			GLC_ARRAY_DATA(inContext->atlasVertices),
+			GL_STATIC_DRAW_ARB);
 
       /* Do the actual GL rendering */
       glInterleavedArrays(GL_T2F_V3F, 0, NULL);
@@ -565,8 +1375,13 @@ void __glcRenderCharTexture(const __GLCfont* inFont, __GLCcontext* inContext,
 	return;
       }
 
-      /* Create the display list */
+      /* Create the display list. The texture of the page where the glyph is
+       * stored is bound by the display list itself.
+       */
       glNewList(inGlyph->glObject[1], GL_COMPILE);
+      glBindTexture(GL_TEXTURE_2D,
+		    GLC_ATLAS_PAGE(inContext,
+				   inGlyph->textureObject->page)->id);
       glScalef(1. / (64. * inScaleX), 1. / (64. * inScaleY) , 1.);
 
       /* Modify the bounding box dimensions to compensate the glScalef() */
@@ -575,23 +1390,14 @@ void __glcRenderCharTexture(const __GLCfont* inFont, __GLCcontext* inContext,
       pixBoundingBox[2] *= inScaleX / GLC_TEXTURE_SIZE;
       pixBoundingBox[3] *= inScaleY / GLC_TEXTURE_SIZE;
 
-      pixWidth = GLC_TEXTURE_SIZE;
-      pixHeight = GLC_TEXTURE_SIZE;
+      pixWidth = rectWidth;
+      pixHeight = rectHeight;
     }
   }
 
   /* Do the actual GL rendering */
-  glBegin(GL_QUADS);
-  glTexCoord2f(texX / texWidth, texY / texHeight);
-  glVertex2iv(pixBoundingBox);
-  glTexCoord2f((texX + pixWidth - 1) / texWidth, texY / texHeight);
-  glVertex2i(pixBoundingBox[2], pixBoundingBox[1]);
-  glTexCoord2f((texX + pixWidth - 1) / texWidth,
-	       (texY + pixHeight - 1) / texHeight);
-  glVertex2iv(pixBoundingBox + 2);
-  glTexCoord2f(texX / texWidth, (texY + pixHeight - 1) / texHeight);
-  glVertex2i(pixBoundingBox[0], pixBoundingBox[3]);
-  glEnd();
+  __glcTextureRenderQuad(texX, texY, pixWidth, pixHeight, texWidth, texHeight,
+			 pixBoundingBox);
 
   if (inContext->enableState.glObjects) {
     /* Finish display list creation */
@@ -600,3 +1406,119 @@ void __glcRenderCharTexture(const __GLCfont* inFont, __GLCcontext* inContext,
     glCallList(inGlyph->glObject[1]);
   }
 }
+
+
+
+/* Copy the quad of the glyph stored in 'inAtlasNode' to 'outQuad' and
+ * translate it by 'inPen'. The quad vertices are read from the copy of the VBO
+ * content of the atlas.
+ */
+static void __glcTextureAtlasGetGlyphQuad(const __GLCcontext* inContext,
+					  const __GLCatlasElement* inAtlasNode,
+					  const GLfloat* inPen,
+					  GLfloat* outQuad)
+{
+  int i = 0;
+
+  memcpy(outQuad, (GLfloat*)GLC_ARRAY_DATA(inContext->atlasVertices)
+	 + inAtlasNode->position * 20, 20 * sizeof(GLfloat));
+
+  /* Translate the 4 vertices of the quad */
+  for (i = 0; i < 4; i++) {
+    outQuad[5*i + 2] += inPen[0];
+    outQuad[5*i + 3] += inPen[1];
+  }
+}
+
+
+
+/* This function appends the quad of the glyph stored in 'inAtlasNode' to the
+ * texture batch of its page. The quad is translated by 'inPen' so that the
+ * whole string can be rendered with a single call to glDrawArrays() per page
+ * of the texture atlas.
+ * The function returns GL_FALSE if the quad could not be stored in the batch.
+ */
+GLboolean __glcTextureAtlasBatchGlyph(__GLCcontext* inContext,
+				      const __GLCatlasElement* inAtlasNode,
+				      const GLfloat* inPen)
+{
+  __GLCarray* batch = GLC_ATLAS_PAGE(inContext, inAtlasNode->page)->batch;
+  GLfloat data[20];
+
+  __glcTextureAtlasGetGlyphQuad(inContext, inAtlasNode, inPen, data);
+
+  if (!__glcArrayAppend(batch, data)) {
+    /* Not enough memory to grow the batch : render the quads that have
+     * already been collected, then try again with an empty batch.
+     */
+    __glcTextureAtlasFlushBatch(inContext);
+    if (!__glcArrayAppend(batch, data))
+      return GL_FALSE;
+  }
+
+  return GL_TRUE;
+}
+
+
+
+/* This function renders on its own the quad of the glyph stored in
+ * 'inAtlasNode' translated by 'inPen'. It is used when the quad can not be
+ * stored in the texture batch.
+ */
+void __glcTextureAtlasDrawGlyph(__GLCcontext* inContext,
+				const __GLCatlasElement* inAtlasNode,
+				const GLfloat* inPen)
+{
+  GLfloat data[20];
+
+  __glcTextureAtlasGetGlyphQuad(inContext, inAtlasNode, inPen, data);
+
+  glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
+  glBindTexture(GL_TEXTURE_2D,
+		GLC_ATLAS_PAGE(inContext, inAtlasNode->page)->id);
+  glInterleavedArrays(GL_T2F_V3F, 0, data);
+  glDrawArrays(GL_QUADS, 0, 4);
+
+  /* Restore the bindings that are expected by the rest of the rendering */
+  glBindBufferARB(GL_ARRAY_BUFFER_ARB, inContext->atlas.bufferObjectID);
+  glInterleavedArrays(GL_T2F_V3F, 0, NULL);
+}
+
+
+
+/* This function renders the quads that are stored in the texture batches of
+ * the pages of the atlas with a single draw call per page, then empties the
+ * batches. The quads are read from the client memory so the VBO of the atlas
+ * is temporarily unbound.
+ */
+void __glcTextureAtlasFlushBatch(__GLCcontext* inContext)
+{
+  GLboolean flushed = GL_FALSE;
+  int i = 0;
+
+  for (i = 0; i < GLC_ARRAY_LENGTH(inContext->atlasPages); i++) {
+    __GLCatlasPage* page = GLC_ATLAS_PAGE(inContext, i);
+    GLint length = GLC_ARRAY_LENGTH(page->batch);
+
+    if (!length)
+      continue;
+
+    if (!flushed) {
+      glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
+      flushed = GL_TRUE;
+    }
+
+    glBindTexture(GL_TEXTURE_2D, page->id);
+    glInterleavedArrays(GL_T2F_V3F, 0, GLC_ARRAY_DATA(page->batch));
+    glDrawArrays(GL_QUADS, 0, length * 4);
+
+    GLC_ARRAY_LENGTH(page->batch) = 0;
+  }
+
+  if (!flushed)
+    return;
+
+  /* Restore the bindings that are expected by the rest of the rendering */
+  glBindBufferARB(GL_ARRAY_BUFFER_ARB, inContext->atlas.bufferObjectID);
+  glInterleavedArrays(GL_T2F_V3F, 0, NULL);
+}
@@ -29,15 +29,82 @@
 
 #define GLC_TEXTURE_SIZE        64
 
+/* The glyphs are packed in the texture atlas in rectangles which dimensions
+ * are multiples of GLC_ATLAS_ALIGNMENT texels. Hence the mipmap levels of a
+ * glyph do not overlap its neighbours down to GLC_ATLAS_MAX_LEVEL.
+ */
+#define GLC_ATLAS_ALIGNMENT     8
+#define GLC_ATLAS_MAX_LEVEL     3
+#define GLC_ATLAS_PADDING       2
+#define GLC_ATLAS_MAX_GLYPH_SIZE (2 * GLC_TEXTURE_SIZE)
+/* The atlas is repacked when the released areas reach this ratio of the atlas
+ * area and a new glyph still does not fit in any of them.
+ */
+#define GLC_ATLAS_REPACK_RATIO  0.5f
+/* Default number of textures that the atlas can use before glyphs are evicted
+ * (see GLC_ATLAS_PAGE_BUDGET_QSO).
+ */
+#define GLC_ATLAS_PAGE_BUDGET   4
+
+/* A page of the texture atlas: a texture and the packer of the glyphs that it
+ * stores. All the pages have the same size which is also given by the width
+ * and the height of the member 'atlas' of the context. The texture cache of the
+ * immediate mode is managed as a page of its own.
+ */
+struct __GLCatlasPageRec {
+  GLuint id;			/* Texture object */
+  GLint width;			/* Size of the texture */
+  GLint height;
+  __GLCarray* skyline;		/* Skyline of the packer */
+  __GLCarray* freeRects;	/* Released areas of the page */
+  GLint freeArea;		/* Total area of freeRects */
+  GLint count;			/* Number of glyphs stored in the page */
+  __GLCarray* batch;		/* Quads of the string being rendered */
+};
+
+#define GLC_ATLAS_PAGE(context, index) \
+  (((__GLCatlasPage*)GLC_ARRAY_DATA((context)->atlasPages)) + (index))
+
 struct __GLCatlasElementRec {
   FT_ListNodeRec node;
 
-  int position;
+  int page;			/* Index of the page that stores the glyph */
+  int position;			/* Index of the quad in the VBO */
+  GLint rect[4];		/* x, y, width and height in texels */
   __GLCglyph* glyph;
 };
 
+/* A glyph stored in the texture cache of the immediate mode (that is when
+ * GLC_GL_OBJECTS is disabled). The image of a glyph depends on the size of the
+ * character on the screen so a glyph may have several images in the cache.
+ */
+struct __GLCtextureCacheElementRec {
+  FT_ListNodeRec node;		/* Node of the LRU list of the cache */
+  __GLCtextureCacheElement* next; /* Next image of the same glyph */
+  __GLCglyph* glyph;
+
+  /* Parameters that the image has been rasterized with */
+  FT_F26Dot6 scale[2];		/* Size of the character */
+  GLint resolution;
+  GLboolean hinting;
+
+  GLint rect[4];		/* x, y, width and height in texels */
+  GLint boundingBox[4];		/* Bounding box in 26.6 pixel coordinates */
+};
+
 void __glcReleaseAtlasElement(__GLCatlasElement* This, __GLCcontext* inContext);
+void __glcReleaseTextureCacheElement(__GLCtextureCacheElement* This,
+				     __GLCcontext* inContext);
+void __glcTextureCacheDestroy(__GLCcontext* inContext);
 void __glcRenderCharTexture(const __GLCfont* inFont, __GLCcontext* inContext,
 			    const GLfloat inScaleX, const GLfloat inScaleY,
 			    __GLCglyph* inGlyph);
+GLboolean __glcTextureAtlasBatchGlyph(__GLCcontext* inContext,
+				      const __GLCatlasElement* inAtlasNode,
+				      const GLfloat* inPen);
+void __glcTextureAtlasDrawGlyph(__GLCcontext* inContext,
+				const __GLCatlasElement* inAtlasNode,
+				const GLfloat* inPen);
+void __glcTextureAtlasFlushBatch(__GLCcontext* inContext);
+void __glcTextureAtlasDestroyPages(__GLCcontext* inContext);
 #endif
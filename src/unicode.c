@@ -26,56 +26,149 @@
  */
 
 #include <fribidi/fribidi.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 #include "internal.h"
 
 
 
-static int __glcGetNameCallback(void* inData, int argc, char** argv,
-				char** GLC_UNUSED_ARG(azColName))
+/* Short names of the jamos which compose the names of the Hangul syllables
+ * (see section 3.12 of the Unicode standard).
+ */
+static const char* __glcJamoL[19] = {
+  "G", "GG", "N", "D", "DD", "R", "M", "B", "BB", "S", "SS", "", "J", "JJ",
+  "C", "K", "T", "P", "H"
+};
+
+static const char* __glcJamoV[21] = {
+  "A", "AE", "YA", "YAE", "EO", "E", "YEO", "YE", "O", "WA", "WAE", "OE", "YO",
+  "U", "WEO", "WE", "WI", "YU", "EU", "YI", "I"
+};
+
+static const char* __glcJamoT[28] = {
+  "", "G", "GG", "GS", "N", "NJ", "NH", "D", "L", "LG", "LM", "LB", "LS", "LT",
+  "LP", "LH", "M", "B", "BS", "S", "SS", "NG", "J", "C", "K", "T", "P", "H"
+};
+
+#define GLC_HANGUL_BASE		0xac00
+#define GLC_HANGUL_COUNT	11172
+#define GLC_HANGUL_PREFIX	"HANGUL SYLLABLE "
+
+
+
+/* Hash function of the minimal perfect hash of the names. It must be the same
+ * than the function nameHash() of database/buildDB.py.
+ */
+static GLCchar32 __glcNameHash(const GLCchar8* inName, const GLCchar32 inSeed)
 {
-  if (argc && argv[0]) {
-#ifdef _MSC_VER
-    sprintf_s((char*)inData, 256, "%s", argv[0]);
-#else
-    snprintf((char*)inData, 256, "%s", argv[0]);
-#endif
-    return 0;
+  GLCchar32 hash = 0x811c9dc5 ^ inSeed;
+
+  for (; *inName; inName++) {
+    hash ^= *inName;
+    hash *= 0x01000193;
+  }
+
+  return hash;
+}
+
+
+
+/* Decode the name which index is 'inIndex' in the name table and store it in
+ * 'outName'.
+ */
+static void __glcDecodeName(const GLint inIndex, GLCchar8* outName)
+{
+  const GLCchar8* phrase = __glcNamePhrases + __glcNamePhraseOffsets[inIndex];
+  const GLCchar8* end = __glcNamePhrases + __glcNamePhraseOffsets[inIndex+1];
+  GLCchar8* name = outName;
+
+  while (phrase < end) {
+    GLint word = *(phrase++);
+    GLint length = 0;
+
+    /* The most frequent words are encoded on 1 byte, the others on 2 bytes */
+    if (word & 0x80)
+      word = ((word & 0x7f) << 8) | *(phrase++);
+
+    if (name != outName)
+      *(name++) = ' ';
+
+    length = __glcNameWordOffsets[word+1] - __glcNameWordOffsets[word];
+    memcpy(name, __glcNameLexicon + __glcNameWordOffsets[word], length);
+    name += length;
   }
 
-  return -1; /* Error: No name found */
+  *name = 0;
 }
 
 
 
-/* Find a Unicode name from its code */
+/* Find a Unicode name from its code. The name is stored in the thread area
+ * so the returned string is valid until the next call to this function by the
+ * same thread.
+ */
 const GLCchar8* __glcGetNameFromCode(const GLint code)
 {
-  if ((code >= 0) && (code < 0x110000)) {
-    static char buffer[50];
-    static GLCchar8 name[256];
-    int result = 0;
-    char* errorMsg = NULL;
+  __GLCthreadArea* area = GLC_GET_THREAD_AREA();
+  GLCchar8* name = area->charName;
+  GLint start = 0;
+  GLint end = __glcNameRangeCount - 1;
+  GLint i = 0;
+
+  if ((code < 0) || (code > 0x10ffff)) {
+    __glcRaiseError(GLC_PARAMETER_ERROR);
+    return NULL;
+  }
+
+  /* The names of the Hangul syllables and of the ideographs are computed */
+  if ((code >= GLC_HANGUL_BASE) && (code < GLC_HANGUL_BASE + GLC_HANGUL_COUNT))
+  {
+    GLint index = code - GLC_HANGUL_BASE;
 
-    name[0] = '\0';
 #ifdef _MSC_VER
-    sprintf_s(buffer, 50, "SELECT name FROM unicode WHERE code=%d", code);
+    sprintf_s((char*)name, GLC_CHAR_NAME_LEN, "%s%s%s%s", GLC_HANGUL_PREFIX,
+	      __glcJamoL[index / 588], __glcJamoV[(index % 588) / 28],
+	      __glcJamoT[index % 28]);
 #else
-    snprintf(buffer, 50, "SELECT name FROM unicode WHERE code=%d", code);
+    snprintf((char*)name, GLC_CHAR_NAME_LEN, "%s%s%s%s", GLC_HANGUL_PREFIX,
+	     __glcJamoL[index / 588], __glcJamoV[(index % 588) / 28],
+	     __glcJamoT[index % 28]);
 #endif
-    result = sqlite3_exec(__glcCommonArea.db, buffer, __glcGetNameCallback,
-			  name, &errorMsg);
-    if (result != SQLITE_OK) {
-      sqlite3_free(errorMsg);
-      __glcRaiseError(GLC_PARAMETER_ERROR);
-      return NULL;
-    }
+    return name;
+  }
+
+  for (i = 0; i < __glcIdeographRangeCount; i++) {
+    const __GLCideographRange* range = &__glcIdeographRanges[i];
 
-    return name[0] ? name : NULL;
+    if (((GLCchar32)code >= range->first) && ((GLCchar32)code <= range->last)) {
+#ifdef _MSC_VER
+      sprintf_s((char*)name, GLC_CHAR_NAME_LEN, "%s%04X", range->prefix, code);
+#else
+      snprintf((char*)name, GLC_CHAR_NAME_LEN, "%s%04X", range->prefix, code);
+#endif
+      return name;
+    }
   }
-  else {
-    __glcRaiseError(GLC_PARAMETER_ERROR);
-    return NULL;
+
+  /* Look by dichotomy for the range of consecutive codes which contains
+   * 'code'.
+   */
+  while (start <= end) {
+    GLint middle = (start + end) >> 1;
+    const __GLCnameRange* range = &__glcNameRanges[middle];
+
+    if ((GLCchar32)code < range->code)
+      end = middle - 1;
+    else if ((GLCchar32)code >= range->code + range->count)
+      start = middle + 1;
+    else {
+      __glcDecodeName(range->name + code - range->code, name);
+      return name;
+    }
   }
 
   return NULL;
@@ -83,17 +176,39 @@ const GLCchar8* __glcGetNameFromCode(const GLint code)
 
 
 
-static int __glcGetCodeCallback(void* inData, int argc, char** argv,
-				char** GLC_UNUSED_ARG(azColName))
+/* Find the code of a Hangul syllable from its name. Returns -1 if 'inName' is
+ * not the name of a Hangul syllable.
+ */
+static GLint __glcGetHangulCodeFromName(const GLCchar8* inName)
 {
-  GLint* code = (GLint*)inData;
+  const char* name = (const char*)inName + strlen(GLC_HANGUL_PREFIX);
+  GLint l = 0;
+  GLint v = 0;
+  GLint t = 0;
+
+  /* Several jamos can match the beginning of the name (e.g. "G" and "GG") so
+   * all the combinations are checked.
+   */
+  for (l = 0; l < 19; l++) {
+    size_t lengthL = strlen(__glcJamoL[l]);
+
+    if (strncmp(name, __glcJamoL[l], lengthL))
+      continue;
 
-  if (argc && argv[0]) {
-    *code = strtol(argv[0], NULL, 10);
-    return 0;
+    for (v = 0; v < 21; v++) {
+      size_t lengthV = strlen(__glcJamoV[v]);
+
+      if (strncmp(name + lengthL, __glcJamoV[v], lengthV))
+	continue;
+
+      for (t = 0; t < 28; t++) {
+	if (!strcmp(name + lengthL + lengthV, __glcJamoT[t]))
+	  return GLC_HANGUL_BASE + (l * 21 + v) * 28 + t;
+      }
+    }
   }
 
-  return -1; /* Error: no code found */
+  return -1;
 }
 
 
@@ -101,32 +216,76 @@ static int __glcGetCodeCallback(void* inData, int argc, char** argv,
 /* Find a Unicode code from its name */
 GLint __glcGetCodeFromName(const GLCchar8* name)
 {
-  static char buffer[256];
-  int result = 0;
-  GLint code = 0;
-  char* errorMsg = NULL;
+  __GLCthreadArea* area = GLC_GET_THREAD_AREA();
+  GLCchar32 hash = 0;
+  GLint seed = 0;
+  GLint index = 0;
+  GLint start = 0;
+  GLint end = __glcNameRangeCount - 1;
+  GLint i = 0;
 
   /* Sanity checks to reject malformed requests */
-  if (!strlen((const char*)name) || strstr((const char*)name, "\"")) {
+  if (!name[0]) {
     __glcRaiseError(GLC_PARAMETER_ERROR);
     return -1;
   }
 
-#ifdef _MSC_VER
-  sprintf_s(buffer, 256, "SELECT code FROM unicode WHERE name=\"%s\"", name);
-#else
-  snprintf(buffer, 256, "SELECT code FROM unicode WHERE name=\"%s\"", name);
-#endif
+  if (!strncmp((const char*)name, GLC_HANGUL_PREFIX,
+	       strlen(GLC_HANGUL_PREFIX))) {
+    GLint code = __glcGetHangulCodeFromName(name);
+
+    if (code >= 0)
+      return code;
+  }
+
+  for (i = 0; i < __glcIdeographRangeCount; i++) {
+    const __GLCideographRange* range = &__glcIdeographRanges[i];
+    size_t length = strlen(range->prefix);
+
+    if (!strncmp((const char*)name, range->prefix, length)) {
+      GLint code = strtol((const char*)name + length, NULL, 16);
 
-  result = sqlite3_exec(__glcCommonArea.db, buffer, __glcGetCodeCallback,
-			&code, &errorMsg);
-  if (result != SQLITE_OK) {
-    sqlite3_free(errorMsg);
+      /* The name must be exactly the one that is built from the code */
+      if (((GLCchar32)code >= range->first)
+	  && ((GLCchar32)code <= range->last)
+	  && (__glcGetNameFromCode(code) == area->charName)
+	  && !strcmp((const char*)area->charName, (const char*)name))
+	return code;
+    }
+  }
+
+  /* Get the slot of the name from the minimal perfect hash */
+  hash = __glcNameHash(name, 0);
+  seed = __glcNameSeeds[hash % __glcNameBucketCount];
+  if (seed < 0)
+    index = __glcNameSlots[-seed - 1];
+  else
+    index = __glcNameSlots[__glcNameHash(name, seed) % __glcNameCount];
+
+  /* The hash maps any string to a slot : check that the name of the slot is
+   * the requested one.
+   */
+  __glcDecodeName(index, area->charName);
+  if (strcmp((const char*)area->charName, (const char*)name)) {
     __glcRaiseError(GLC_PARAMETER_ERROR);
     return -1;
   }
 
-  return code;
+  /* Look by dichotomy for the range which contains the name */
+  while (start <= end) {
+    GLint middle = (start + end) >> 1;
+    const __GLCnameRange* range = &__glcNameRanges[middle];
+
+    if (index < range->name)
+      end = middle - 1;
+    else if (index >= range->name + range->count)
+      start = middle + 1;
+    else
+      return range->code + index - range->name;
+  }
+
+  __glcRaiseError(GLC_PARAMETER_ERROR);
+  return -1;
 }
 
 
@@ -174,6 +333,149 @@ static int __glcUcs2ToUtf8(const GLCchar16 ucs2, GLCchar8 dest[FC_UTF8_MAX_LEN])
 
 
 
+/* Convert a character from UTF-8 to UCS-4 and return the number of bytes
+ * needed to encode the character, or -1 if the character is ill-formed.
+ * Unlike FcUtf8ToUcs4(), the decoding follows strictly the RFC 3629 : overlong
+ * forms, surrogates, codes beyond 0x10ffff and truncated sequences are
+ * rejected. The bytes of 'inString' are read one by one so that the decoding
+ * stops at the first byte which is not a continuation byte (in particular the
+ * '\0' character), hence 'inLength' may exceed the actual length of the string.
+ */
+static int __glcUtf8DecodeChar(const GLCchar8* inString, GLCchar32* outCode,
+			       const int inLength)
+{
+  GLCchar32 code = inString[0];
+  GLCchar32 min = 0;
+  int length = 0;
+  int i = 0;
+
+  if (code < 0x80) {
+    *outCode = code;
+    return 1;
+  }
+  else if (code < 0xc2) /* Continuation byte or overlong 2-bytes form */
+    return -1;
+  else if (code < 0xe0) {
+    code &= 0x1f;
+    length = 2;
+    min = 0x80;
+  }
+  else if (code < 0xf0) {
+    code &= 0x0f;
+    length = 3;
+    min = 0x800;
+  }
+  else if (code < 0xf5) {
+    code &= 0x07;
+    length = 4;
+    min = 0x10000;
+  }
+  else
+    return -1;
+
+  if (length > inLength)
+    return -1;
+
+  for (i = 1; i < length; i++) {
+    if ((inString[i] & 0xc0) != 0x80)
+      return -1;
+    code = (code << 6) | (inString[i] & 0x3f);
+  }
+
+  if ((code < min) || (code > 0x10ffff)
+      || ((code >= 0xd800) && (code <= 0xdfff)))
+    return -1;
+
+  *outCode = code;
+  return length;
+}
+
+
+
+/* Convert at most 'inCount' characters of the UTF-8 string 'inString' to
+ * UCS-4. No more than 'inLength' bytes are read and the conversion stops at
+ * the '\0' character. The number of converted characters is returned or -1 if
+ * 'inString' contains an ill-formed character.
+ * Runs of ASCII characters are converted 16 at a time with the SIMD
+ * instructions of the processor when they are available. A block of 16 bytes
+ * is only loaded when either limit guarantees that it lies within the string :
+ * 'inLength' for '\0' terminated strings, 'inCount' for counted strings since
+ * every character is encoded on one byte at least.
+ */
+static int __glcUtf8ToUcs4String(const GLCchar8* inString, GLCchar32* outString,
+				 const int inLength, const int inCount)
+{
+  const GLCchar8* utf8 = inString;
+  const GLCchar8* end = inString + inLength;
+  GLCchar32* ucs4 = outString;
+  GLCchar32* last = outString + inCount;
+  int shift = 0;
+
+  while ((ucs4 < last) && (utf8 < end)) {
+#if defined(__SSE2__)
+    if (((end - utf8) >= 16) && ((last - ucs4) >= 16)) {
+      const __m128i zero = _mm_setzero_si128();
+      __m128i block = _mm_loadu_si128((const __m128i*)utf8);
+      __m128i lo, hi;
+
+      /* Bytes >= 0x80 have their sign bit set and '\0' must stop the
+       * conversion : leave both cases to the scalar decoder.
+       */
+      if (!_mm_movemask_epi8(_mm_or_si128(block,
+					  _mm_cmpeq_epi8(block, zero)))) {
+	lo = _mm_unpacklo_epi8(block, zero);
+	hi = _mm_unpackhi_epi8(block, zero);
+	_mm_storeu_si128((__m128i*)ucs4, _mm_unpacklo_epi16(lo, zero));
+	_mm_storeu_si128((__m128i*)(ucs4 + 4), _mm_unpackhi_epi16(lo, zero));
+	_mm_storeu_si128((__m128i*)(ucs4 + 8), _mm_unpacklo_epi16(hi, zero));
+	_mm_storeu_si128((__m128i*)(ucs4 + 12), _mm_unpackhi_epi16(hi, zero));
+	utf8 += 16;
+	ucs4 += 16;
+	continue;
+      }
+    }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    if (((end - utf8) >= 16) && ((last - ucs4) >= 16)) {
+      uint8x16_t block = vld1q_u8(utf8);
+
+      /* Leave non ASCII characters and '\0' to the scalar decoder */
+      if ((vmaxvq_u8(block) < 0x80) && vminvq_u8(block)) {
+	uint16x8_t lo = vmovl_u8(vget_low_u8(block));
+	uint16x8_t hi = vmovl_u8(vget_high_u8(block));
+
+	vst1q_u32(ucs4, vmovl_u16(vget_low_u16(lo)));
+	vst1q_u32(ucs4 + 4, vmovl_u16(vget_high_u16(lo)));
+	vst1q_u32(ucs4 + 8, vmovl_u16(vget_low_u16(hi)));
+	vst1q_u32(ucs4 + 12, vmovl_u16(vget_high_u16(hi)));
+	utf8 += 16;
+	ucs4 += 16;
+	continue;
+      }
+    }
+#endif
+
+    if (!*utf8)
+      break;
+
+    /* Skip the ASCII characters one by one up to the next SIMD block */
+    if (*utf8 < 0x80) {
+      *(ucs4++) = *(utf8++);
+      continue;
+    }
+
+    shift = __glcUtf8DecodeChar(utf8, ucs4, end - utf8);
+    if (shift < 0)
+      return -1;
+
+    utf8 += shift;
+    ucs4++;
+  }
+
+  return ucs4 - outString;
+}
+
+
+
 /* Convert a character from UTF-8 to UCS1 and return the number of bytes
  * needed to encode the character.
  * According to the GLC specs, when the value of a character code exceed the
@@ -186,7 +488,7 @@ static int __glcUtf8ToUcs1(const GLCchar8* src_orig,
 			   int* dstlen)
 {
   GLCchar32 result = 0;
-  int src_shift = FcUtf8ToUcs4(src_orig, &result, len);
+  int src_shift = __glcUtf8DecodeChar(src_orig, &result, len);
 
   if (src_shift > 0) {
     /* src_orig is a well-formed UTF-8 character */
@@ -234,7 +536,7 @@ static int __glcUtf8ToUcs2(const GLCchar8* src_orig,
 			   int* dstlen)
 {
   GLCchar32 result = 0;
-  int src_shift = FcUtf8ToUcs4(src_orig, &result, len);
+  int src_shift = __glcUtf8DecodeChar(src_orig, &result, len);
 
   if (src_shift > 0) {
     /* src_orig is a well-formed UTF-8 character */
@@ -375,12 +677,19 @@ GLCchar* __glcConvertFromUtf8ToBuffer(__GLCcontext* This,
 {
   GLCchar* string = NULL;
   const GLCchar8* utf8 = NULL;
+  const GLCchar8* end = NULL;
   int len_buffer = 0;
   int len = 0;
   int shift = 0;
 
   assert(inString);
 
+  /* The remaining length of the string is passed to the decoder rather than
+   * calling strlen() for each character, which would make the conversion
+   * quadratic.
+   */
+  end = inString + strlen((const char*)inString);
+
   switch(This->stringState.stringType) {
   case GLC_UCS1:
     {
@@ -390,8 +699,7 @@ GLCchar* __glcConvertFromUtf8ToBuffer(__GLCcontext* This,
       /* Determine the length of the final string */
       utf8 = inString;
       while(*utf8) {
-	shift = __glcUtf8ToUcs1(utf8, buffer, strlen((const char*)utf8),
-				&len_buffer);
+	shift = __glcUtf8ToUcs1(utf8, buffer, end - utf8, &len_buffer);
 	if (shift < 0) {
 	  /* There is an ill-formed character in the UTF-8 string, abort */
 	  return NULL;
@@ -410,8 +718,7 @@ GLCchar* __glcConvertFromUtf8ToBuffer(__GLCcontext* This,
       ucs1 = (GLCchar8*)string;
       utf8 = inString;
       while(*utf8) {
-	utf8 += __glcUtf8ToUcs1(utf8, ucs1, strlen((const char*)utf8),
-				&len_buffer);
+	utf8 += __glcUtf8ToUcs1(utf8, ucs1, end - utf8, &len_buffer);
 	ucs1 += len_buffer;
       }
 
@@ -426,8 +733,7 @@ GLCchar* __glcConvertFromUtf8ToBuffer(__GLCcontext* This,
       /* Determine the length of the final string */
       utf8 = inString;
       while(*utf8) {
-	shift = __glcUtf8ToUcs2(utf8, buffer, strlen((const char*)utf8),
-				&len_buffer);
+	shift = __glcUtf8ToUcs2(utf8, buffer, end - utf8, &len_buffer);
 	if (shift < 0) {
 	  /* There is an ill-formed character in the UTF-8 string, abort */
 	  return NULL;
@@ -446,53 +752,36 @@ GLCchar* __glcConvertFromUtf8ToBuffer(__GLCcontext* This,
       ucs2 = (GLCchar16*)string;
       utf8 = inString;
       while(*utf8) {
-	utf8 += __glcUtf8ToUcs2(utf8, ucs2, strlen((const char*)utf8),
-				&len_buffer);
+	utf8 += __glcUtf8ToUcs2(utf8, ucs2, end - utf8, &len_buffer);
 	ucs2 += len_buffer;
       }
       *ucs2 = 0; /* Add the '\0' termination of the string */
     }
     break;
   case GLC_UCS4:
-    {
-      GLCchar32 buffer = 0;
-      GLCchar32* ucs4 = NULL;
-
-      /* Determine the length of the final string */
-      utf8 = inString;
-      while(*utf8) {
-	shift = FcUtf8ToUcs4(utf8, &buffer, strlen((const char*)utf8));
-	if (shift < 0) {
-	  /* There is an ill-formed character in the UTF-8 string, abort */
-	  __glcRaiseError(GLC_PARAMETER_ERROR);
-	  return NULL;
-	}
-	utf8 += shift;
-	len++;
-      }
-
-      /* Allocate the room to store the final string */
-      string = (GLCchar*)__glcContextQueryBuffer(This,
-						 (len+1)*sizeof(GLCchar32));
-      if (!string)
-	return NULL; /* GLC_RESOURCE_ERROR has been raised */
-
-
-      /* Perform the conversion */
-      utf8 = inString;
-      ucs4 = (GLCchar32*)string;
-      while(*utf8)
-	utf8 += FcUtf8ToUcs4(utf8, ucs4++, strlen((const char*)utf8));
+    /* The final string has at most one character per byte of the UTF-8
+     * string, so it can be converted in a single pass.
+     */
+    len = end - inString;
+    string = (GLCchar*)__glcContextQueryBuffer(This,
+					       (len+1)*sizeof(GLCchar32));
+    if (!string)
+      return NULL; /* GLC_RESOURCE_ERROR has been raised */
 
-      *ucs4 = 0; /* Add the '\0' termination of the string */
+    len = __glcUtf8ToUcs4String(inString, (GLCchar32*)string, len, len);
+    if (len < 0) {
+      /* There is an ill-formed character in the UTF-8 string, abort */
+      __glcRaiseError(GLC_PARAMETER_ERROR);
+      return NULL;
     }
+
+    ((GLCchar32*)string)[len] = 0; /* Add the '\0' termination of the string */
     break;
   case GLC_UTF8_QSO:
     /* If the string is already encoded in UTF-8 format then all we need to do
      * is to make a copy of it.
      */
-    string = (GLCchar*)__glcContextQueryBuffer(This,
-				 	       strlen((const char*)inString)+1);
+    string = (GLCchar*)__glcContextQueryBuffer(This, (end - inString) + 1);
     if (!string)
       return NULL; /* GLC_RESOURCE_ERROR has been raised */
     strcpy((char*)string, (const char*)inString);
@@ -579,8 +868,8 @@ GLint __glcConvertGLintToUcs4(const __GLCcontext *inContext, GLint inCode)
     /* Convert the codepoint in UCS4 format and check if it is ill-formed or
      * not
      */
-    if (FcUtf8ToUcs4((GLCchar8*)&inCode, (GLCchar32*)&code,
-		     sizeof(GLint)) < 0) {
+    if (__glcUtf8DecodeChar((GLCchar8*)&inCode, (GLCchar32*)&code,
+			    sizeof(GLint)) < 0) {
       __glcRaiseError(GLC_PARAMETER_ERROR);
       return -1;
     }
@@ -592,6 +881,86 @@ GLint __glcConvertGLintToUcs4(const __GLCcontext *inContext, GLint inCode)
 
 
 
+/* Check if the UCS-4 string 'inString' contains characters which need the
+ * bidirectional algorithm to be run : right-to-left letters, Arabic digits and
+ * explicit embeddings or overrides. Otherwise the visual order of the string is
+ * its logical order and the string is rendered from left to right.
+ * The code points below 0x590 (the beginning of the Hebrew block) are all
+ * left-to-right or neutral characters so they are skipped 4 at a time when SIMD
+ * instructions are available.
+ */
+static GLboolean __glcStringNeedsBidi(const GLCchar32* inString,
+				      const GLint inLength)
+{
+  GLint i = 0;
+
+#if defined(__SSE2__)
+  const __m128i max = _mm_set1_epi32(0x58f);
+
+  /* The code points are lower than 0x110000 so the signed comparison is safe */
+  for (; i + 4 <= inLength; i += 4) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(inString + i));
+
+    if (_mm_movemask_epi8(_mm_cmpgt_epi32(block, max)))
+      break;
+  }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+  for (; i + 4 <= inLength; i += 4) {
+    if (vmaxvq_u32(vld1q_u32(inString + i)) > 0x58f)
+      break;
+  }
+#endif
+
+  for (; i < inLength; i++) {
+    if ((inString[i] > 0x58f)
+	&& (fribidi_get_type(inString[i])
+	    & (FRIBIDI_MASK_RTL | FRIBIDI_MASK_ARABIC | FRIBIDI_MASK_EXPLICIT)))
+      return GL_TRUE;
+  }
+
+  return GL_FALSE;
+}
+
+
+
+/* Reorder the 'inLength' characters of the UCS-4 string 'inString' (which is
+ * stored at the beginning of the context buffer) in visual order. The string is
+ * returned as is unless it contains characters which need the bidirectional
+ * algorithm : the context buffer is then grown so that the visual string is
+ * stored right after the logical string.
+ */
+static GLCchar32* __glcReorderUcs4(__GLCcontext* inContext,
+				   GLboolean *outIsRTL, GLCchar32* inString,
+				   const GLint inLength)
+{
+  FriBidiCharType base = FRIBIDI_TYPE_ON;
+  GLCchar32* string = inString;
+  GLCchar32* visualString = NULL;
+
+  *outIsRTL = GL_FALSE;
+
+  if (!__glcStringNeedsBidi(string, inLength))
+    return string;
+
+  string = (GLCchar32*)__glcContextQueryBuffer(inContext,
+					      2*(inLength+1)*sizeof(GLCchar32));
+  if (!string)
+    return NULL; /* GLC_RESOURCE_ERROR has been raised */
+
+  visualString = string + inLength + 1;
+  if (!fribidi_log2vis(string, inLength, &base, visualString, NULL, NULL,
+		       NULL)) {
+    __glcRaiseError(GLC_RESOURCE_ERROR);
+    return NULL;
+  }
+
+  *outIsRTL = FRIBIDI_IS_RTL(base) ? GL_TRUE : GL_FALSE;
+
+  return visualString;
+}
+
+
+
 /* Convert 'inString' (stored in logical order) to UCS4 format and return a
  * copy of the converted string in visual order.
  */
@@ -601,8 +970,6 @@ GLCchar32* __glcConvertToVisualUcs4(__GLCcontext* inContext,
 {
   GLCchar32* string = NULL;
   int length = 0;
-  FriBidiCharType base = FRIBIDI_TYPE_ON;
-  GLCchar32* visualString = NULL;
 
   assert(inString);
 
@@ -616,7 +983,7 @@ GLCchar32* __glcConvertToVisualUcs4(__GLCcontext* inContext,
 
       /* Allocate the room to store the final string */
       string = (GLCchar32*)__glcContextQueryBuffer(inContext,
-					      2*(length+1)*sizeof(GLCchar32));
+					      (length+1)*sizeof(GLCchar32));
       if (!string)
 	return NULL; /* GLC_RESOURCE_ERROR has been raised */
 
@@ -635,7 +1002,7 @@ GLCchar32* __glcConvertToVisualUcs4(__GLCcontext* inContext,
 
       /* Allocate the room to store the final string */
       string = (GLCchar32*)__glcContextQueryBuffer(inContext,
-					      2*(length+1)*sizeof(GLCchar32));
+					      (length+1)*sizeof(GLCchar32));
       if (!string)
 	return NULL; /* GLC_RESOURCE_ERROR has been raised */
 
@@ -654,7 +1021,7 @@ GLCchar32* __glcConvertToVisualUcs4(__GLCcontext* inContext,
 
       /* Allocate the room to store the final string */
       string = (GLCchar32*)__glcContextQueryBuffer(inContext,
-					      2*(length+1)*sizeof(int));
+					      (length+1)*sizeof(int));
       if (!string)
 	return NULL; /* GLC_RESOURCE_ERROR has been raised */
 
@@ -665,56 +1032,32 @@ GLCchar32* __glcConvertToVisualUcs4(__GLCcontext* inContext,
     break;
   case GLC_UTF8_QSO:
     {
-      GLCchar32* ucs4 = NULL;
-      const GLCchar8* utf8 = NULL;
-      GLCchar32 buffer = 0;
-      int shift = 0;
-
-      /* Determine the length of the final string */
-      utf8 = (const GLCchar8*)inString;
-      while(*utf8) {
-	shift = FcUtf8ToUcs4(utf8, &buffer, strlen((const char*)utf8));
-	if (shift < 0) {
-	  /* There is an ill-formed character in the UTF-8 string, abort */
-	  return NULL;
-	}
-	utf8 += shift;
-	length++;
-      }
+      int size = strlen((const char*)inString);
 
-      /* Allocate the room to store the final string */
+      /* The string has at most one character per byte : allocate the room for
+       * the worst case and convert the string in a single pass.
+       */
       string = (GLCchar32*)__glcContextQueryBuffer(inContext,
-					      2*(length+1)*sizeof(GLCchar32));
+					      (size+1)*sizeof(GLCchar32));
       if (!string)
 	return NULL; /* GLC_RESOURCE_ERROR has been raised */
 
-      /* Perform the conversion */
-      utf8 = (const GLCchar8*)inString;
-      ucs4 = (GLCchar32*)string;
-      while(*utf8)
-	utf8 += FcUtf8ToUcs4(utf8, ucs4++, strlen((const char*)utf8));
+      length = __glcUtf8ToUcs4String((const GLCchar8*)inString, string, size,
+				     size);
+      if (length < 0) {
+	/* There is an ill-formed character in the UTF-8 string, abort */
+	__glcRaiseError(GLC_PARAMETER_ERROR);
+	return NULL;
+      }
 
-      *ucs4 = 0; /* Add the '\0' termination of the string */
+      string[length] = 0; /* Add the '\0' termination of the string */
     }
     break;
   }
 
-  if (length) {
-    visualString = string + length + 1;
-    if (!fribidi_log2vis(string, length, &base, visualString, NULL, NULL,
-                         NULL)) {
-      __glcRaiseError(GLC_RESOURCE_ERROR);
-      return NULL;
-    }
-
-    *outIsRTL = FRIBIDI_IS_RTL(base) ? GL_TRUE : GL_FALSE;
-  }
-  else
-    visualString = string;
-
   *outLength = length;
 
-  return visualString;
+  return __glcReorderUcs4(inContext, outIsRTL, string, length);
 }
 
 
@@ -728,8 +1071,6 @@ GLCchar32* __glcConvertCountedStringToVisualUcs4(__GLCcontext* inContext,
 						const GLint inCount)
 {
   GLCchar32* string = NULL;
-  FriBidiCharType base = FRIBIDI_TYPE_ON;
-  GLCchar32* visualString = NULL;
 
   assert(inString);
 
@@ -742,7 +1083,7 @@ GLCchar32* __glcConvertCountedStringToVisualUcs4(__GLCcontext* inContext,
 
       /* Allocate the room to store the final string */
       string = (GLCchar32*)__glcContextQueryBuffer(inContext,
-					      2*(inCount+1)*sizeof(GLCchar32));
+					      (inCount+1)*sizeof(GLCchar32));
       if (!string)
 	return NULL; /* GLC_RESOURCE_ERROR has been raised */
 
@@ -762,7 +1103,7 @@ GLCchar32* __glcConvertCountedStringToVisualUcs4(__GLCcontext* inContext,
 
       /* Allocate the room to store the final string */
       string = (GLCchar32*)__glcContextQueryBuffer(inContext,
-					      2*(inCount+1)*sizeof(GLCchar32));
+					      (inCount+1)*sizeof(GLCchar32));
       if (!string)
 	return NULL; /* GLC_RESOURCE_ERROR has been raised */
 
@@ -779,7 +1120,7 @@ GLCchar32* __glcConvertCountedStringToVisualUcs4(__GLCcontext* inContext,
     {
       /* Allocate the room to store the final string */
       string = (GLCchar32*)__glcContextQueryBuffer(inContext,
-					      2*(inCount+1)*sizeof(int));
+					      (inCount+1)*sizeof(int));
       if (!string)
 	return NULL; /* GLC_RESOURCE_ERROR has been raised */
 
@@ -789,37 +1130,26 @@ GLCchar32* __glcConvertCountedStringToVisualUcs4(__GLCcontext* inContext,
     }
     break;
   case GLC_UTF8_QSO:
-    {
-      GLCchar32* ucs4 = NULL;
-      const GLCchar8* utf8 = NULL;
-      GLint i = 0;
-
-      /* Allocate the room to store the final string */
-      string = (GLCchar32*)__glcContextQueryBuffer(inContext,
-					      2*(inCount+1)*sizeof(GLCchar32));
-      if (!string)
-	return NULL; /* GLC_RESOURCE_ERROR has been raised */
-
-      /* Perform the conversion */
-      utf8 = (const GLCchar8*)inString;
-      ucs4 = (GLCchar32*)string;
-
-      for (i = 0; i < inCount; i++)
-	utf8 += FcUtf8ToUcs4(utf8, ucs4++, strlen((const char*)utf8));
+    /* Allocate the room to store the final string */
+    string = (GLCchar32*)__glcContextQueryBuffer(inContext,
+					      (inCount+1)*sizeof(GLCchar32));
+    if (!string)
+      return NULL; /* GLC_RESOURCE_ERROR has been raised */
 
-      *ucs4 = 0; /* Add the '\0' termination of the string */
+    /* Perform the conversion : every character is encoded on 4 bytes at most
+     * and the decoding stops at the '\0' character so that the string is not
+     * read beyond its end.
+     */
+    if (__glcUtf8ToUcs4String((const GLCchar8*)inString, string, 4*inCount,
+			      inCount) != inCount) {
+      /* The UTF-8 string is ill-formed or shorter than 'inCount' */
+      __glcRaiseError(GLC_PARAMETER_ERROR);
+      return NULL;
     }
-    break;
-  }
 
-  visualString = string + inCount;
-  if (!fribidi_log2vis(string, inCount, &base, visualString, NULL, NULL,
-		       NULL)) {
-    __glcRaiseError(GLC_RESOURCE_ERROR);
-    return NULL;
+    string[inCount] = 0; /* Add the '\0' termination of the string */
+    break;
   }
 
-  *outIsRTL = FRIBIDI_IS_RTL(base) ? GL_TRUE : GL_FALSE;
-
-  return visualString;
+  return __glcReorderUcs4(inContext, outIsRTL, string, inCount);
 }
@@ -0,0 +1,169 @@
+/* QuesoGLC
+ * A free implementation of the OpenGL Character Renderer (GLC)
+ * Copyright (c) 2002, 2004-2009, Bertrand Coconnier
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+/* $Id$ */
+
+/** \file
+ * Micro-benchmark of the conversion of UTF-8 strings. Long strings made of
+ * ASCII, CJK and emoji characters are measured with glcMeasureString() and
+ * glcMeasureCountedString(), and the time spent is reported. The test also
+ * checks that the number of characters is right and that ill-formed UTF-8
+ * strings are rejected with a GLC_PARAMETER_ERROR.
+ */
+
+#include "GL/glc.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define STRING_SIZE 100000
+#define LOOP_COUNT 10
+
+/* Characters used to build the corpora, encoded in UTF-8 */
+static const char* ascii = "[12:34:56] glc: the quick brown fox jumps over";
+static const char* cjk = "\xe4\xb8\xad\xe6\x96\x87\xe6\x97\xa5\xe6\x9c\xac";
+static const char* emoji = "\xf0\x9f\x98\x80\xf0\x9f\x8e\x89";
+
+/* Ill-formed UTF-8 strings : overlong form, surrogate, code beyond 0x10ffff,
+ * truncated sequence, stray continuation byte and invalid byte at the end of a
+ * long ASCII run.
+ */
+static const char* illFormed[] = {
+  "ab\xc0\xaf",
+  "ab\xed\xa0\x80",
+  "ab\xf4\x90\x80\x80",
+  "ab\xe4\xb8",
+  "ab\x80",
+  "abcdefghijklmnopqrstuvwxyz0123456789\xff",
+  NULL
+};
+
+/* Fill 'outString' with the characters of 'inPattern' up to STRING_SIZE bytes
+ * and return the number of characters of the string.
+ */
+static GLint buildCorpus(char* outString, const char* inPattern,
+			 GLint inPatternCount)
+{
+  size_t length = strlen(inPattern);
+  size_t size = 0;
+  GLint count = 0;
+
+  while (size + length < STRING_SIZE) {
+    memcpy(outString + size, inPattern, length);
+    size += length;
+    count += inPatternCount;
+  }
+  outString[size] = 0;
+
+  return count;
+}
+
+static int benchmark(const char* inName, const char* inString, GLint inCount)
+{
+  clock_t start = 0;
+  double measure = 0.;
+  double counted = 0.;
+  int i = 0;
+
+  start = clock();
+  for (i = 0; i < LOOP_COUNT; i++) {
+    if (glcMeasureString(GL_FALSE, inString) != inCount) {
+      printf("%s : glcMeasureString() does not return %d\n", inName, inCount);
+      return 0;
+    }
+  }
+  measure = (double)(clock() - start) / CLOCKS_PER_SEC / LOOP_COUNT;
+
+  start = clock();
+  for (i = 0; i < LOOP_COUNT; i++) {
+    if (glcMeasureCountedString(GL_FALSE, inCount, inString) != inCount) {
+      printf("%s : glcMeasureCountedString() does not return %d\n", inName,
+	     inCount);
+      return 0;
+    }
+  }
+  counted = (double)(clock() - start) / CLOCKS_PER_SEC / LOOP_COUNT;
+
+  printf("%-6s %7d chars : %8.3f ms (string) %8.3f ms (counted string)\n",
+	 inName, inCount, measure * 1000., counted * 1000.);
+  return 1;
+}
+
+int main(void)
+{
+  GLint ctx = 0;
+  GLint count = 0;
+  char* string = NULL;
+  char pattern[256];
+  int i = 0;
+
+  string = (char*)malloc(STRING_SIZE);
+  if (!string) {
+    printf("Not enough memory\n");
+    return EXIT_FAILURE;
+  }
+
+  ctx = glcGenContext();
+  glcContext(ctx);
+  glcStringType(GLC_UTF8_QSO);
+
+  /* Warm up the glyph caches */
+  glcMeasureString(GL_FALSE, ascii);
+  glcMeasureString(GL_FALSE, cjk);
+  glcMeasureString(GL_FALSE, emoji);
+
+  count = buildCorpus(string, ascii, strlen(ascii));
+  if (!benchmark("ASCII", string, count))
+    return EXIT_FAILURE;
+
+  count = buildCorpus(string, cjk, 4);
+  if (!benchmark("CJK", string, count))
+    return EXIT_FAILURE;
+
+  count = buildCorpus(string, emoji, 2);
+  if (!benchmark("Emoji", string, count))
+    return EXIT_FAILURE;
+
+  sprintf(pattern, "%s%s %s", ascii, cjk, emoji);
+  count = buildCorpus(string, pattern, strlen(ascii) + 4 + 1 + 2);
+  if (!benchmark("Mixed", string, count))
+    return EXIT_FAILURE;
+
+  glcGetError();
+  for (i = 0; illFormed[i]; i++) {
+    if (glcMeasureString(GL_FALSE, illFormed[i])
+	|| (glcGetError() != GLC_PARAMETER_ERROR)) {
+      printf("Ill-formed string #%d has been accepted\n", i);
+      return EXIT_FAILURE;
+    }
+
+    if (glcMeasureCountedString(GL_FALSE, strlen(illFormed[i]), illFormed[i])
+	|| (glcGetError() != GLC_PARAMETER_ERROR)) {
+      printf("Ill-formed counted string #%d has been accepted\n", i);
+      return EXIT_FAILURE;
+    }
+  }
+
+  free(string);
+  glcDeleteContext(ctx);
+  glcContext(0);
+
+  printf("Tests successful !\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,215 @@
+/* QuesoGLC
+ * A free implementation of the OpenGL Character Renderer (GLC)
+ * Copyright (c) 2002, 2004-2009, Bertrand Coconnier
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+/* $Id$ */
+
+/** \file
+ * Micro-benchmark of the rendering of strings with the GLC_TEXTURE style. A
+ * page of text is rendered with and without GLC_GL_OBJECTS and the time spent
+ * per frame is reported. With the GNU C library, the draw calls (glBegin(),
+ * glDrawArrays(), glDrawElements() and glCallList()) issued by QuesoGLC are
+ * intercepted and their number per frame is reported too : the test fails if
+ * a string is not rendered with one draw call per page of the texture atlas
+ * when GLC_GL_OBJECTS is enabled.
+ */
+
+#define _GNU_SOURCE
+#include "GL/glc.h"
+#if defined __APPLE__ && defined __MACH__
+#include <GLUT/glut.h>
+#else
+#include <GL/glut.h>
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+#ifdef __GLIBC__
+#include <dlfcn.h>
+#define COUNT_DRAW_CALLS
+#endif
+
+#define LINE_COUNT 40
+#define FRAME_COUNT 20
+
+static const char* text = "The quick brown fox jumps over the lazy dog. "
+  "AVAWAY Te Yo fi fl 0123456789";
+static unsigned long drawCalls = 0;
+
+#ifdef COUNT_DRAW_CALLS
+/* The draw calls are counted then forwarded to the GL library */
+void glBegin(GLenum mode)
+{
+  static void (*func)(GLenum) = NULL;
+
+  if (!func)
+    func = (void (*)(GLenum))dlsym(RTLD_NEXT, "glBegin");
+  drawCalls++;
+  func(mode);
+}
+
+void glDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+  static void (*func)(GLenum, GLint, GLsizei) = NULL;
+
+  if (!func)
+    func = (void (*)(GLenum, GLint, GLsizei))dlsym(RTLD_NEXT, "glDrawArrays");
+  drawCalls++;
+  func(mode, first, count);
+}
+
+void glDrawElements(GLenum mode, GLsizei count, GLenum type,
+		    const GLvoid* indices)
+{
+  static void (*func)(GLenum, GLsizei, GLenum, const GLvoid*) = NULL;
+
+  if (!func)
+    func = (void (*)(GLenum, GLsizei, GLenum, const GLvoid*))
+      dlsym(RTLD_NEXT, "glDrawElements");
+  drawCalls++;
+  func(mode, count, type, indices);
+}
+
+void glCallList(GLuint list)
+{
+  static void (*func)(GLuint) = NULL;
+
+  if (!func)
+    func = (void (*)(GLuint))dlsym(RTLD_NEXT, "glCallList");
+  drawCalls++;
+  func(list);
+}
+#endif
+
+void reshape(int width, int height)
+{
+  glClearColor(0., 0., 0., 0.);
+  glViewport(0, 0, width, height);
+  glMatrixMode(GL_PROJECTION);
+  glLoadIdentity();
+  gluOrtho2D(0., width, 0., height);
+  glMatrixMode(GL_MODELVIEW);
+  glLoadIdentity();
+  glFlush();
+}
+
+/* Render LINE_COUNT lines of text and wait for the GL to complete */
+static void renderFrame(void)
+{
+  int i = 0;
+
+  glClear(GL_COLOR_BUFFER_BIT);
+  for (i = 0; i < LINE_COUNT; i++) {
+    glLoadIdentity();
+    glTranslatef(5.f, 590.f - 14.f * (i + 1), 0.f);
+    glScalef(12.f, 12.f, 1.f);
+    glcRenderString(text);
+  }
+  glFinish();
+}
+
+/* Render FRAME_COUNT frames and return the number of draw calls per frame */
+static unsigned long benchmark(const char* inName)
+{
+  clock_t start = 0;
+  double frameTime = 0.;
+  int i = 0;
+
+  /* The first frame fills the texture atlas and is not measured */
+  renderFrame();
+
+  drawCalls = 0;
+  start = clock();
+  for (i = 0; i < FRAME_COUNT; i++)
+    renderFrame();
+  frameTime = (double)(clock() - start) / CLOCKS_PER_SEC / FRAME_COUNT;
+
+#ifdef COUNT_DRAW_CALLS
+  printf("%-16s : %8.3f ms per frame, %6lu draw calls per frame\n", inName,
+	 frameTime * 1000., drawCalls / FRAME_COUNT);
+#else
+  printf("%-16s : %8.3f ms per frame\n", inName, frameTime * 1000.);
+#endif
+
+  return drawCalls / FRAME_COUNT;
+}
+
+void display(void)
+{
+  GLCenum glcErr = GLC_NONE;
+#ifdef COUNT_DRAW_CALLS
+  unsigned long pageCount = 0;
+  unsigned long frameDrawCalls = 0;
+
+  glcEnable(GLC_GL_OBJECTS);
+  frameDrawCalls = benchmark("GL objects");
+
+  /* Each string must be rendered with one draw call per page of the atlas */
+  pageCount = glcGeti(GLC_TEXTURE_OBJECT_COUNT);
+  if (frameDrawCalls > LINE_COUNT * pageCount) {
+    printf("%lu draw calls per frame for %d strings and %lu atlas pages\n",
+	   frameDrawCalls, LINE_COUNT, pageCount);
+    exit(EXIT_FAILURE);
+  }
+#else
+  glcEnable(GLC_GL_OBJECTS);
+  benchmark("GL objects");
+#endif
+
+  glcDisable(GLC_GL_OBJECTS);
+  benchmark("No GL objects");
+
+  glcErr = glcGetError();
+  if (glcErr != GLC_NONE) {
+    printf("GLC error 0x%X\n", (int)glcErr);
+    exit(EXIT_FAILURE);
+  }
+
+  printf("Tests successful !\n");
+  exit(EXIT_SUCCESS);
+}
+
+int main(int argc, char **argv)
+{
+  GLint ctx = 0;
+  GLint myFont = 0;
+
+  glutInit(&argc, argv);
+  glutInitDisplayMode(GLUT_SINGLE | GLUT_RGB);
+  glutInitWindowSize(640, 600);
+  glutCreateWindow("Test20");
+  glutDisplayFunc(display);
+  glutReshapeFunc(reshape);
+
+  ctx = glcGenContext();
+  glcContext(ctx);
+
+  myFont = glcGenFontID();
+  glcNewFontFromFamily(myFont, "DejaVu Sans");
+  glcFont(myFont);
+  glcEnable(GLC_KERNING_QSO);
+  glcRenderStyle(GLC_TEXTURE);
+
+  glEnable(GL_TEXTURE_2D);
+  glEnable(GL_BLEND);
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+  glColor3f(1.f, 1.f, 1.f);
+
+  glutMainLoop();
+  return 0;
+}
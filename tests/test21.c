@@ -0,0 +1,125 @@
+/* QuesoGLC
+ * A free implementation of the OpenGL Character Renderer (GLC)
+ * Copyright (c) 2002, 2004-2009, Bertrand Coconnier
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+/* $Id$ */
+
+/** \file
+ * Checks that the metrics preloaded with GLC_PRELOAD_METRICS_QSO match the
+ * metrics that are read from each glyph. The baseline and the bounding box of
+ * the characters of several scripts are queried in two contexts, one with and
+ * one where they are read from each glyph, and are compared. The preloaded
+ * metrics are not hinted, so the glyphs are not hinted either in the latter
+ * context : GLC_GL_OBJECTS must then be disabled since the glyphs are always
+ * hinted when it is enabled.
+ */
+
+#include "GL/glc.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+#define EPSILON 1e-3
+
+/* Ranges of the characters that are checked */
+static const GLint ranges[][2] = {
+  {0x20, 0x7e},		/* Basic Latin */
+  {0xa0, 0x17f},	/* Latin-1 and Latin Extended-A */
+  {0x391, 0x3c9},	/* Greek */
+  {0x400, 0x45f},	/* Cyrillic */
+  {0, 0}
+};
+
+/* Create a context that uses the font "DejaVu Sans" */
+static GLint createContext(GLboolean inPreload)
+{
+  GLint ctx = glcGenContext();
+
+  glcContext(ctx);
+  glcFont(glcNewFontFromFamily(glcGenFontID(), "DejaVu Sans"));
+  glcStringType(GLC_UCS4);
+  glcDisable(GLC_HINTING_QSO);
+  if (inPreload) {
+    glcEnable(GLC_GL_OBJECTS);
+    glcEnable(GLC_PRELOAD_METRICS_QSO);
+  }
+  else {
+    glcDisable(GLC_GL_OBJECTS);
+    glcDisable(GLC_PRELOAD_METRICS_QSO);
+  }
+
+  return ctx;
+}
+
+static int compareMetric(GLint inCode, const char* inName,
+			 const GLfloat* inPreloaded, const GLfloat* inGlyph,
+			 int inCount)
+{
+  int i = 0;
+
+  for (i = 0; i < inCount; i++) {
+    if (fabs(inPreloaded[i] - inGlyph[i]) > EPSILON) {
+      printf("Character 0x%X : %s[%d] is %f instead of %f\n", (int)inCode,
+	     inName, i, inPreloaded[i], inGlyph[i]);
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+int main(void)
+{
+  GLint preloadCtx = 0;
+  GLint glyphCtx = 0;
+  GLfloat preloaded[12];
+  GLfloat glyph[12];
+  GLint code = 0;
+  int i = 0;
+
+  preloadCtx = createContext(GL_TRUE);
+  glyphCtx = createContext(GL_FALSE);
+
+  for (i = 0; ranges[i][0]; i++) {
+    for (code = ranges[i][0]; code <= ranges[i][1]; code++) {
+      glcContext(preloadCtx);
+      if (!glcGetCharMetric(code, GLC_BASELINE, preloaded)
+	  || !glcGetCharMetric(code, GLC_BOUNDS, preloaded + 4)) {
+	printf("Character 0x%X : the metrics can not be preloaded\n", (int)code);
+	return EXIT_FAILURE;
+      }
+
+      glcContext(glyphCtx);
+      if (!glcGetCharMetric(code, GLC_BASELINE, glyph)
+	  || !glcGetCharMetric(code, GLC_BOUNDS, glyph + 4)) {
+	printf("Character 0x%X : the metrics can not be read\n", (int)code);
+	return EXIT_FAILURE;
+      }
+
+      if (!compareMetric(code, "baseline", preloaded, glyph, 4)
+	  || !compareMetric(code, "bounds", preloaded + 4, glyph + 4, 8))
+	return EXIT_FAILURE;
+    }
+  }
+
+  glcContext(0);
+  glcDeleteContext(preloadCtx);
+  glcDeleteContext(glyphCtx);
+
+  printf("Tests successful !\n");
+  return EXIT_SUCCESS;
+}
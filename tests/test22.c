@@ -0,0 +1,174 @@
+/* QuesoGLC
+ * A free implementation of the OpenGL Character Renderer (GLC)
+ * Copyright (c) 2002, 2004-2009, Bertrand Coconnier
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+/* $Id$ */
+
+/** \file
+ * Checks that glcGetFontCharCodesQSO() and glcGetMasterCharCodesQSO() return
+ * the characters of GLC_CHAR_LIST in the same order than glcGetFontListc()
+ * and glcGetMasterListc(), from the first to the last element of the list.
+ * The codes are checked both when the list is read at once and when it is
+ * read one element at a time.
+ */
+
+#include "GL/glc.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+#define NAME_LENGTH 128
+
+typedef const GLCchar* (APIENTRY *getListcFunc)(GLint, GLCenum, GLint);
+typedef const GLCchar* (APIENTRY *getMapFunc)(GLint, GLint);
+typedef GLint (APIENTRY *getCharCodesFunc)(GLint, GLint, GLint, GLint*);
+
+/* Copy the UCS-4 string 'inName' in 'outName' */
+static int copyName(GLint* outName, const GLCchar* inName)
+{
+  const GLint* name = (const GLint*)inName;
+  int i = 0;
+
+  if (!name)
+    return 0;
+
+  for (i = 0; name[i]; i++) {
+    if (i == NAME_LENGTH - 1)
+      return 0;
+    outName[i] = name[i];
+  }
+  outName[i] = 0;
+
+  return 1;
+}
+
+/* Compare the UCS-4 strings 'inName1' and 'inName2' */
+static int compareNames(const GLint* inName1, const GLCchar* inName2)
+{
+  const GLint* name = (const GLint*)inName2;
+  int i = 0;
+
+  if (!name)
+    return 0;
+
+  for (i = 0; inName1[i] && (inName1[i] == name[i]); i++);
+
+  return inName1[i] == name[i];
+}
+
+static int checkCharCodes(const char* inName, GLint inID, GLint inCount,
+			  getListcFunc inGetListc, getMapFunc inGetMap,
+			  getCharCodesFunc inGetCharCodes)
+{
+  GLint* codes = NULL;
+  GLint name[NAME_LENGTH];
+  GLint code = 0;
+  GLint i = 0;
+  int match = 0;
+
+  if (!inCount) {
+    printf("%s : GLC_CHAR_COUNT is zero\n", inName);
+    return 0;
+  }
+
+  codes = (GLint*)malloc((inCount + 1) * sizeof(GLint));
+  if (!codes) {
+    printf("Not enough memory\n");
+    return 0;
+  }
+
+  /* The list is read at once : the codes beyond its end are not stored */
+  if (inGetCharCodes(inID, 0, inCount + 1, codes) != inCount) {
+    printf("%s : the character list has not %d elements\n", inName, inCount);
+    free(codes);
+    return 0;
+  }
+
+  for (i = 0; i < inCount; i++) {
+    if (i && (codes[i] <= codes[i - 1])) {
+      printf("%s : the codes are not sorted at index %d\n", inName, i);
+      free(codes);
+      return 0;
+    }
+
+    /* The list is read one element at a time */
+    if ((inGetCharCodes(inID, i, 1, &code) != 1) || (code != codes[i])) {
+      printf("%s : wrong code at index %d\n", inName, i);
+      free(codes);
+      return 0;
+    }
+
+    /* The name is copied since the next command overwrites it. The characters
+     * which have no name (in the private use areas for instance) are listed
+     * as GLC_NONE.
+     */
+    if (copyName(name, inGetListc(inID, GLC_CHAR_LIST, i)))
+      match = compareNames(name, inGetMap(inID, codes[i]));
+    else
+      match = !inGetMap(inID, codes[i]);
+
+    if (!match) {
+      printf("%s : the code 0x%X at index %d is not the character of "
+	     "GLC_CHAR_LIST\n", inName, (int)codes[i], i);
+      free(codes);
+      return 0;
+    }
+  }
+
+  free(codes);
+
+  /* No code is stored beyond the end of the list */
+  if (glcGetError() != GLC_NONE) {
+    printf("%s : unexpected GLC error\n", inName);
+    return 0;
+  }
+
+  if (inGetCharCodes(inID, inCount, 1, &code)
+      || (glcGetError() != GLC_PARAMETER_ERROR)) {
+    printf("%s : the end of the character list is not detected\n", inName);
+    return 0;
+  }
+
+  return 1;
+}
+
+int main(void)
+{
+  GLint ctx = 0;
+  GLint font = 0;
+
+  ctx = glcGenContext();
+  glcContext(ctx);
+
+  font = glcNewFontFromMaster(glcGenFontID(), 0);
+  glcStringType(GLC_UCS4);
+  glcGetError();
+
+  if (!checkCharCodes("Master", 0, glcGetMasteri(0, GLC_CHAR_COUNT),
+		      glcGetMasterListc, glcGetMasterMap,
+		      glcGetMasterCharCodesQSO))
+    return EXIT_FAILURE;
+
+  if (!checkCharCodes("Font", font, glcGetFonti(font, GLC_CHAR_COUNT),
+		      glcGetFontListc, glcGetFontMap, glcGetFontCharCodesQSO))
+    return EXIT_FAILURE;
+
+  glcDeleteContext(ctx);
+  glcContext(0);
+
+  printf("Tests successful !\n");
+  return EXIT_SUCCESS;
+}
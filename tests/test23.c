@@ -0,0 +1,203 @@
+/* QuesoGLC
+ * A free implementation of the OpenGL Character Renderer (GLC)
+ * Copyright (c) 2002, 2004-2009, Bertrand Coconnier
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+/* $Id$ */
+
+/** \file
+ * Checks that the catalogs loaded in the background (GLC_ASYNC_CATALOG_QSO)
+ * give the same masters than the catalogs loaded synchronously. A catalog is
+ * appended in two contexts, synchronously in the first one and in the
+ * background in the second one, then the catalog lists, the master count and
+ * the family of each master ID are compared once GLC_PENDING_CATALOG_COUNT_QSO
+ * has dropped to 0. The catalog may be given on the command line.
+ */
+
+#include "GL/glc.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/* Maximum time to wait for the loader, in seconds */
+#define TIMEOUT 60
+
+/* Directories which are tried when no catalog is given */
+static const char* catalogs[] = {
+  "/usr/share/fonts",
+  "/usr/X11R6/lib/X11/fonts",
+  "/System/Library/Fonts",
+  "C:\\WINDOWS\\Fonts",
+  NULL
+};
+
+/* Masters and catalogs of a context */
+typedef struct {
+  GLint catalogCount;
+  GLint masterCount;
+  char** families;
+} State;
+
+static char* duplicate(const GLCchar* inString)
+{
+  char* string = NULL;
+
+  if (!inString)
+    return NULL;
+
+  string = (char*)malloc(strlen((const char*)inString) + 1);
+  if (string)
+    strcpy(string, (const char*)inString);
+  return string;
+}
+
+/* Read the catalogs and the masters of the current context */
+static int readState(State* outState)
+{
+  GLint i = 0;
+
+  outState->catalogCount = glcGeti(GLC_CATALOG_COUNT);
+  outState->masterCount = glcGeti(GLC_MASTER_COUNT);
+  outState->families = (char**)malloc((outState->masterCount + 1)
+				      * sizeof(char*));
+  if (!outState->families) {
+    printf("Not enough memory\n");
+    return 0;
+  }
+
+  for (i = 0; i < outState->masterCount; i++) {
+    outState->families[i] = duplicate(glcGetMasterc(i, GLC_FAMILY));
+    if (!outState->families[i]) {
+      printf("The family of the master %d can not be read\n", (int)i);
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static int compareStates(const State* inSync, const State* inAsync)
+{
+  GLint i = 0;
+
+  if (inSync->catalogCount != inAsync->catalogCount) {
+    printf("%d catalogs instead of %d\n", (int)inAsync->catalogCount,
+	   (int)inSync->catalogCount);
+    return 0;
+  }
+
+  if (inSync->masterCount != inAsync->masterCount) {
+    printf("%d masters instead of %d\n", (int)inAsync->masterCount,
+	   (int)inSync->masterCount);
+    return 0;
+  }
+
+  for (i = 0; i < inSync->masterCount; i++) {
+    if (strcmp(inSync->families[i], inAsync->families[i])) {
+      printf("The master %d is %s instead of %s\n", (int)i,
+	     inAsync->families[i], inSync->families[i]);
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+int main(int argc, char **argv)
+{
+  GLint ctx = 0;
+  const char* catalog = NULL;
+  State syncState;
+  State asyncState;
+  clock_t start = 0;
+  GLint count = 0;
+  int i = 0;
+
+  /* The catalog is first loaded synchronously */
+  ctx = glcGenContext();
+  glcContext(ctx);
+  count = glcGeti(GLC_CATALOG_COUNT);
+
+  if (argc > 1) {
+    catalog = argv[1];
+    glcAppendCatalog(catalog);
+  }
+  else {
+    for (i = 0; catalogs[i]; i++) {
+      catalog = catalogs[i];
+      glcAppendCatalog(catalog);
+      if (glcGeti(GLC_CATALOG_COUNT) > count)
+	break;
+    }
+  }
+
+  if (glcGeti(GLC_CATALOG_COUNT) == count) {
+    printf("No catalog can be appended\n");
+    return EXIT_FAILURE;
+  }
+
+  if (!readState(&syncState))
+    return EXIT_FAILURE;
+
+  glcContext(0);
+  glcDeleteContext(ctx);
+
+  /* Then it is loaded in the background */
+  ctx = glcGenContext();
+  glcContext(ctx);
+  glcEnable(GLC_ASYNC_CATALOG_QSO);
+  glcGetError();
+
+  glcAppendCatalog(catalog);
+  if (glcGetError()) {
+    printf("The catalog %s has been rejected\n", catalog);
+    return EXIT_FAILURE;
+  }
+
+  start = clock();
+  while (glcGeti(GLC_PENDING_CATALOG_COUNT_QSO)) {
+    if ((clock() - start) > TIMEOUT * CLOCKS_PER_SEC) {
+      printf("The catalog %s is still pending\n", catalog);
+      return EXIT_FAILURE;
+    }
+  }
+
+  /* The failures of the loader are reported by GLC_PENDING_CATALOG_COUNT_QSO */
+  if (glcGetError()) {
+    printf("The catalog %s can not be loaded in the background\n", catalog);
+    return EXIT_FAILURE;
+  }
+
+  if (!readState(&asyncState))
+    return EXIT_FAILURE;
+
+  glcContext(0);
+  glcDeleteContext(ctx);
+
+  if (!compareStates(&syncState, &asyncState))
+    return EXIT_FAILURE;
+
+  for (i = 0; i < syncState.masterCount; i++) {
+    free(syncState.families[i]);
+    free(asyncState.families[i]);
+  }
+  free(syncState.families);
+  free(asyncState.families);
+
+  printf("Tests successful !\n");
+  return EXIT_SUCCESS;
+}
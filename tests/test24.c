@@ -0,0 +1,173 @@
+/* QuesoGLC
+ * A free implementation of the OpenGL Character Renderer (GLC)
+ * Copyright (c) 2002, 2004-2009, Bertrand Coconnier
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+/* $Id$ */
+
+/** \file
+ * Check that the texture atlas does not use more textures than the budget
+ * set by glcRenderParameteriQSO(GLC_ATLAS_PAGE_BUDGET_QSO) when more glyphs
+ * are rendered than a single texture can hold.
+ */
+
+#include "GL/glc.h"
+#if defined __APPLE__ && defined __MACH__
+#include <GLUT/glut.h>
+#else
+#include <GL/glut.h>
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+
+#define GLYPH_COUNT 1200
+
+static GLint codes[GLYPH_COUNT];
+
+void reshape(int width, int height)
+{
+  glClearColor(0., 0., 0., 0.);
+  glViewport(0, 0, width, height);
+  glMatrixMode(GL_PROJECTION);
+  glLoadIdentity();
+  gluOrtho2D(0., width, 0., height);
+  glMatrixMode(GL_MODELVIEW);
+  glLoadIdentity();
+  glFlush();
+}
+
+/* Render GLYPH_COUNT distinct glyphs with the budget inBudget then check that
+ * the atlas uses all the textures of the budget and no more.
+ */
+static void checkBudget(GLint inBudget)
+{
+  GLCenum glcErr = GLC_NONE;
+  GLint count = 0;
+  int i = 0;
+
+  glcRenderParameteriQSO(GLC_ATLAS_PAGE_BUDGET_QSO, inBudget);
+  if (glcGeti(GLC_ATLAS_PAGE_BUDGET_QSO) != inBudget) {
+    printf("The page budget is %d instead of %d\n",
+	   glcGeti(GLC_ATLAS_PAGE_BUDGET_QSO), inBudget);
+    exit(EXIT_FAILURE);
+  }
+
+  /* The glyphs are rendered twice so that the second pass needs to evict the
+   * glyphs of the first one.
+   */
+  for (i = 0; i < 2; i++) {
+    glClear(GL_COLOR_BUFFER_BIT);
+    glLoadIdentity();
+    glTranslatef(5.f, 300.f, 0.f);
+    glScalef(24.f, 24.f, 1.f);
+    glcRenderCountedString(GLYPH_COUNT, codes);
+    glFinish();
+  }
+
+  glcErr = glcGetError();
+  if (glcErr != GLC_NONE) {
+    printf("GLC error 0x%X with a budget of %d pages\n", (int)glcErr,
+	   inBudget);
+    exit(EXIT_FAILURE);
+  }
+
+  count = glcGeti(GLC_TEXTURE_OBJECT_COUNT);
+  if (count > inBudget) {
+    printf("%d textures are used with a budget of %d pages\n", count,
+	   inBudget);
+    exit(EXIT_FAILURE);
+  }
+
+  /* The glyphs do not fit in a single page hence the budget must be used up */
+  if (count < inBudget) {
+    printf("Only %d textures are used with a budget of %d pages\n", count,
+	   inBudget);
+    exit(EXIT_FAILURE);
+  }
+
+  printf("Budget %d : %d textures\n", inBudget, count);
+}
+
+void display(void)
+{
+  GLCenum glcErr = GLC_NONE;
+
+  /* Lowering the budget does not delete the existing textures hence the
+   * budgets are checked in increasing order.
+   */
+  checkBudget(1);
+  checkBudget(2);
+
+  /* A budget lower than 1 must be rejected and leave the budget unchanged */
+  glcRenderParameteriQSO(GLC_ATLAS_PAGE_BUDGET_QSO, 0);
+  glcErr = glcGetError();
+  if (glcErr != GLC_PARAMETER_ERROR) {
+    printf("GLC error 0x%X instead of GLC_PARAMETER_ERROR\n", (int)glcErr);
+    exit(EXIT_FAILURE);
+  }
+
+  glcRenderParameteriQSO(GLC_ATLAS_PAGE_BUDGET_QSO, -1);
+  glcErr = glcGetError();
+  if (glcErr != GLC_PARAMETER_ERROR) {
+    printf("GLC error 0x%X instead of GLC_PARAMETER_ERROR\n", (int)glcErr);
+    exit(EXIT_FAILURE);
+  }
+
+  if (glcGeti(GLC_ATLAS_PAGE_BUDGET_QSO) != 2) {
+    printf("The page budget is %d instead of 2\n",
+	   glcGeti(GLC_ATLAS_PAGE_BUDGET_QSO));
+    exit(EXIT_FAILURE);
+  }
+
+  printf("Tests successful !\n");
+  exit(EXIT_SUCCESS);
+}
+
+int main(int argc, char **argv)
+{
+  GLint ctx = 0;
+  GLint myFont = 0;
+  int i = 0;
+
+  glutInit(&argc, argv);
+  glutInitDisplayMode(GLUT_SINGLE | GLUT_RGB);
+  glutInitWindowSize(640, 600);
+  glutCreateWindow("Test24");
+  glutDisplayFunc(display);
+  glutReshapeFunc(reshape);
+
+  ctx = glcGenContext();
+  glcContext(ctx);
+
+  /* The font must be created before the string type is changed */
+  myFont = glcGenFontID();
+  glcNewFontFromFamily(myFont, "DejaVu Sans");
+  glcFont(myFont);
+  glcRenderStyle(GLC_TEXTURE);
+  glcEnable(GLC_GL_OBJECTS);
+  glcStringType(GLC_UCS4);
+
+  for (i = 0; i < GLYPH_COUNT; i++)
+    codes[i] = 0x100 + i;
+
+  glEnable(GL_TEXTURE_2D);
+  glEnable(GL_BLEND);
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+  glColor3f(1.f, 1.f, 1.f);
+
+  glutMainLoop();
+  return 0;
+}
@@ -48,14 +48,17 @@
 GLEWAPI GLEWContext* glewGetContext(void);
 #endif
 
-static GLCchar* __glcExtensions1 = (GLCchar*) "GLC_QSO_attrib_stack"
+static GLCchar* __glcExtensions1 = (GLCchar*) "GLC_QSO_async_catalog"
+  " GLC_QSO_atlas_page_budget GLC_QSO_attrib_stack GLC_QSO_char_codes"
   " GLC_QSO_extrude GLC_QSO_hinting GLC_QSO_kerning GLC_QSO_matrix_stack"
-  " GLC_QSO_render_parameter GLC_QSO_render_pixmap GLC_QSO_utf8"
-  " GLC_SGI_full_name";
-static GLCchar* __glcExtensions2 = (GLCchar*) "GLC_QSO_attrib_stack"
-  " GLC_QSO_buffer_object GLC_QSO_extrude GLC_QSO_hinting GLC_QSO_kerning"
-  " GLC_QSO_matrix_stack GLC_QSO_render_parameter GLC_QSO_render_pixmap"
+  " GLC_QSO_preload_metrics GLC_QSO_render_parameter GLC_QSO_render_pixmap"
   " GLC_QSO_utf8 GLC_SGI_full_name";
+static GLCchar* __glcExtensions2 = (GLCchar*) "GLC_QSO_async_catalog"
+  " GLC_QSO_atlas_page_budget GLC_QSO_attrib_stack GLC_QSO_buffer_object"
+  " GLC_QSO_char_codes GLC_QSO_extrude GLC_QSO_hinting GLC_QSO_kerning"
+  " GLC_QSO_matrix_stack GLC_QSO_preload_metrics GLC_QSO_render_parameter"
+  " GLC_QSO_render_pixmap GLC_QSO_utf8"
+  " GLC_SGI_full_name";
 static GLCchar* __glcRelease = (GLCchar*) QUESOGLC_VERSION;
 static GLCchar* __glcVendor = (GLCchar*) "The QuesoGLC Project";
 